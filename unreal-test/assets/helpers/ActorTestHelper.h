@@ -3,6 +3,131 @@
 #include "CoreMinimal.h"
 #include "Engine/World.h"
 #include "GameFramework/Actor.h"
+#include "AI/NavigationSystemBase.h"
+#include "UObject/UnrealType.h"
+#include "Containers/ArrayView.h"
+#include <type_traits>
+
+class FActorPropertySet;
+
+/**
+ * FActorPropertyPath
+ * 解析后的属性路径，支持点号分隔的嵌套路径（如 "Stats.Health"、"WeaponComponent.Ammo"）
+ * 嵌套结构体的偏移在解析时合并，只在对象引用处解引用
+ */
+struct FActorPropertyPath
+{
+    /** 路径中的一次对象引用跳转 */
+    struct FObjectHop
+    {
+        /** 对象引用相对当前容器的偏移 */
+        int32 Offset = 0;
+        const FObjectPropertyBase* Property = nullptr;
+    };
+
+    /** 按顺序经过的对象引用 */
+    TArray<FObjectHop, TInlineAllocator<2>> ObjectHops;
+
+    /** 叶子属性值相对最后一个容器的偏移 */
+    int32 LeafOffset = 0;
+
+    /** 叶子属性 */
+    const FProperty* LeafProperty = nullptr;
+
+    bool IsValid() const
+    {
+        return LeafProperty != nullptr;
+    }
+
+    /**
+     * 沿偏移链取得叶子属性值的地址
+     * @param Object 路径起点对象
+     * @return 值地址，途经的对象引用为空时返回nullptr
+     */
+    void* GetValuePtr(UObject* Object) const
+    {
+        uint8* Container = reinterpret_cast<uint8*>(Object);
+        for (const FObjectHop& Hop : ObjectHops)
+        {
+            if (!Container)
+            {
+                return nullptr;
+            }
+            Container = reinterpret_cast<uint8*>(Hop.Property->GetObjectPropertyValue(Container + Hop.Offset));
+        }
+
+        return Container ? Container + LeafOffset : nullptr;
+    }
+};
+
+/**
+ * TActorPropertyTypeTraits
+ * C++类型与FProperty类型的对应关系，供类型化属性访问校验
+ * 未特化的类型不支持类型化访问，使用FVariant版本
+ */
+template<typename TValue, typename = void>
+struct TActorPropertyTypeTraits
+{
+    static constexpr bool bSupported = false;
+};
+
+#define ACTOR_TEST_PROPERTY_TYPE(ValueType, PropertyType) \
+    template<> \
+    struct TActorPropertyTypeTraits<ValueType> \
+    { \
+        static constexpr bool bSupported = true; \
+        static bool Matches(const FProperty* Property) { return Property && Property->IsA<PropertyType>(); } \
+    };
+
+ACTOR_TEST_PROPERTY_TYPE(int32, FIntProperty)
+ACTOR_TEST_PROPERTY_TYPE(int64, FInt64Property)
+ACTOR_TEST_PROPERTY_TYPE(uint8, FByteProperty)
+ACTOR_TEST_PROPERTY_TYPE(float, FFloatProperty)
+ACTOR_TEST_PROPERTY_TYPE(double, FDoubleProperty)
+ACTOR_TEST_PROPERTY_TYPE(FName, FNameProperty)
+ACTOR_TEST_PROPERTY_TYPE(FString, FStrProperty)
+ACTOR_TEST_PROPERTY_TYPE(FText, FTextProperty)
+
+#undef ACTOR_TEST_PROPERTY_TYPE
+
+/** bool只支持原生bool，位域bool无法按地址读写 */
+template<>
+struct TActorPropertyTypeTraits<bool>
+{
+    static constexpr bool bSupported = true;
+    static bool Matches(const FProperty* Property)
+    {
+        const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property);
+        return BoolProperty && BoolProperty->IsNativeBool();
+    }
+};
+
+/** 结构体属性按UScriptStruct匹配 */
+template<typename TValue>
+struct TActorPropertyStructTraits
+{
+    static constexpr bool bSupported = true;
+    static bool Matches(const FProperty* Property)
+    {
+        const FStructProperty* StructProperty = CastField<FStructProperty>(Property);
+        return StructProperty && StructProperty->Struct == TBaseStructure<TValue>::Get();
+    }
+};
+
+/** USTRUCT类型 */
+template<typename TValue>
+struct TActorPropertyTypeTraits<TValue, std::void_t<decltype(&TValue::StaticStruct)>> : TActorPropertyStructTraits<TValue>
+{
+};
+
+/** 没有StaticStruct的核心结构体，对应TBaseStructure的特化 */
+template<> struct TActorPropertyTypeTraits<FVector> : TActorPropertyStructTraits<FVector> {};
+template<> struct TActorPropertyTypeTraits<FVector2D> : TActorPropertyStructTraits<FVector2D> {};
+template<> struct TActorPropertyTypeTraits<FRotator> : TActorPropertyStructTraits<FRotator> {};
+template<> struct TActorPropertyTypeTraits<FQuat> : TActorPropertyStructTraits<FQuat> {};
+template<> struct TActorPropertyTypeTraits<FTransform> : TActorPropertyStructTraits<FTransform> {};
+template<> struct TActorPropertyTypeTraits<FLinearColor> : TActorPropertyStructTraits<FLinearColor> {};
+template<> struct TActorPropertyTypeTraits<FColor> : TActorPropertyStructTraits<FColor> {};
 
 /**
  * ActorTestHelper
@@ -22,6 +147,19 @@ public:
     template<typename T>
     static T* SpawnActor(UWorld* World, const FVector& Location = FVector::ZeroVector, const FRotator& Rotation = FRotator::ZeroRotator);
 
+    /**
+     * 批量延迟生成Actor
+     * 先以延迟构造方式生成整批Actor，再集中执行FinishSpawning（构造脚本、组件注册、BeginPlay），
+     * 期间锁定导航更新，避免逐个生成时的交错开销
+     * @tparam T Actor类型
+     * @param World 目标世界
+     * @param Count 生成数量
+     * @param LayoutFn 根据索引返回生成变换
+     * @return 生成的Actor数组
+     */
+    template<typename T>
+    static TArray<T*> SpawnActorsBatch(UWorld* World, int32 Count, TFunctionRef<FTransform(int32)> LayoutFn);
+
     /**
      * 初始化Actor
      * @param Actor 要初始化的Actor
@@ -31,21 +169,77 @@ public:
 
     /**
      * 设置Actor属性
+     * 属性查找走 ResolvePropertyPath 缓存，值通过FVariant转换
      * @param Actor 目标Actor
-     * @param PropertyName 属性名
+     * @param PropertyName 属性名或点号分隔的嵌套路径
      * @param Value 属性值
      * @return 是否成功
      */
     static bool SetActorProperty(AActor* Actor, const FName& PropertyName, const FVariant& Value);
 
+    /**
+     * 设置Actor属性（类型化版本，不经过FVariant装箱）
+     * 与FVariant版本分开命名，字面量不会意外选中本函数；属性类型不一致时不做转换
+     * @tparam TValue 值类型，需与属性类型一致
+     * @param Actor 目标Actor
+     * @param PropertyPath 属性名或点号分隔的嵌套路径
+     * @param Value 属性值
+     * @return 是否成功，类型不匹配时返回false
+     */
+    template<typename TValue, typename = std::enable_if_t<TActorPropertyTypeTraits<TValue>::bSupported>>
+    static bool SetActorPropertyTyped(AActor* Actor, const FName& PropertyPath, const TValue& Value);
+
     /**
      * 获取Actor属性
+     * 属性查找走 ResolvePropertyPath 缓存，值通过FVariant转换
      * @param Actor 目标Actor
-     * @param PropertyName 属性名
+     * @param PropertyName 属性名或点号分隔的嵌套路径
      * @return 属性值
      */
     static FVariant GetActorProperty(AActor* Actor, const FName& PropertyName);
 
+    /**
+     * 获取Actor属性（类型化版本，不经过FVariant装箱）
+     * @tparam TValue 值类型，需与属性类型一致
+     * @param Actor 目标Actor
+     * @param PropertyPath 属性名或点号分隔的嵌套路径
+     * @param OutValue 输出属性值
+     * @return 是否成功，类型不匹配时返回false
+     */
+    template<typename TValue, typename = std::enable_if_t<TActorPropertyTypeTraits<TValue>::bSupported>>
+    static bool GetActorPropertyTyped(AActor* Actor, const FName& PropertyPath, TValue& OutValue);
+
+    /**
+     * 将预构建的属性集合批量应用到多个Actor
+     * 路径在构建属性集合时已解析，应用时只做偏移寻址和值拷贝
+     * @param Actors 目标Actor
+     * @param PropertySet 预构建的属性集合
+     * @return 成功应用的Actor数量
+     */
+    static int32 SetActorProperties(TArrayView<AActor* const> Actors, const FActorPropertySet& PropertySet);
+
+    /**
+     * 解析属性路径（带缓存）
+     * 按 (UClass, 路径) 缓存解析结果，同一类的后续查找只需一次哈希查找；仅在游戏线程使用
+     * @param Class Actor类
+     * @param PropertyPath 属性名或点号分隔的嵌套路径
+     * @return 解析结果，路径无效时返回nullptr；指针在 ClearPropertyPathCache 之前保持有效
+     */
+    static const FActorPropertyPath* ResolvePropertyPath(const UClass* Class, const FName& PropertyPath);
+
+    /**
+     * 清空属性路径缓存
+     * 热重载或Live Coding改变类布局后调用，之前返回的路径指针全部失效
+     */
+    static void ClearPropertyPathCache();
+
+    /**
+     * 获取属性路径缓存的代数
+     * 每次 ClearPropertyPathCache 后递增，持有路径指针的对象据此判断是否需要重新解析
+     * @return 缓存代数，从1开始
+     */
+    static uint32 GetPropertyPathCacheGeneration();
+
     /**
      * 验证Actor是否有效
      * @param Actor 要验证的Actor
@@ -66,6 +260,249 @@ public:
      * @return 成功销毁的数量
      */
     static int32 DestroyActors(TArray<AActor*>& Actors);
+
+    /**
+     * 将Actor属性恢复为类默认值（CDO）
+     * 用于池化复用，不会重新构建组件
+     * @param Actor 目标Actor
+     * @return 是否成功
+     */
+    static bool ResetActorToDefaults(AActor* Actor);
+};
+
+/**
+ * TActorTestPoolTraits
+ * Actor归还到池时的重置钩子
+ * 默认恢复到类默认值，需要额外重置逻辑的Actor类可特化此模板
+ */
+template<typename T>
+struct TActorTestPoolTraits
+{
+    static void ResetForPool(AActor* Actor)
+    {
+        ActorTestHelper::ResetActorToDefaults(Actor);
+    }
+};
+
+/**
+ * FActorPropertySet
+ * 针对某个Actor类预先构建的属性集合，路径只解析一次，可批量应用到多个Actor
+ */
+class FActorPropertySet
+{
+public:
+    /**
+     * 构造函数
+     * @param InActorClass 属性集合适用的Actor类
+     */
+    explicit FActorPropertySet(const UClass* InActorClass);
+    ~FActorPropertySet();
+
+    FActorPropertySet(const FActorPropertySet&) = delete;
+    FActorPropertySet& operator=(const FActorPropertySet&) = delete;
+
+    /**
+     * 添加属性值，同一路径重复添加时覆盖
+     * @tparam TValue 值类型，需与属性类型一致
+     * @param PropertyPath 属性名或点号分隔的嵌套路径
+     * @param Value 属性值
+     * @return 是否成功，路径无效或类型不匹配时返回false
+     */
+    template<typename TValue>
+    bool Add(const FName& PropertyPath, const TValue& Value);
+
+    /**
+     * 应用到单个Actor
+     * @param Actor 目标Actor，必须是ActorClass或其子类
+     * @return 是否成功
+     */
+    bool ApplyTo(AActor* Actor) const;
+
+    /**
+     * 获取属性数量
+     * @return 属性数量
+     */
+    int32 Num() const;
+
+    /**
+     * 获取适用的Actor类
+     * @return Actor类
+     */
+    const UClass* GetActorClass() const;
+
+private:
+    struct FEntry
+    {
+        const FActorPropertyPath* Path = nullptr;
+
+        /** 由LeafProperty初始化的值存储，析构时由LeafProperty销毁 */
+        TArray<uint8, TAlignedHeapAllocator<16>> Value;
+    };
+
+    const UClass* ActorClass;
+    TArray<FEntry> Entries;
+};
+
+/**
+ * TActorPropertyHandle
+ * 类型化属性句柄，首次访问时解析一次路径，之后直接按偏移读写
+ * 可声明为static：构造时只保存路径字符串，UClass在静态初始化阶段可能尚未注册
+ * @tparam TOwner 属性所属的Actor类
+ * @tparam TValue 属性值类型
+ */
+template<typename TOwner, typename TValue>
+class TActorPropertyHandle
+{
+    static_assert(TIsDerivedFrom<TOwner, AActor>::Value, "TOwner must derive from AActor");
+    static_assert(TActorPropertyTypeTraits<TValue>::bSupported, "Unsupported property value type");
+
+public:
+    /**
+     * 构造函数
+     * @param InPropertyPath 属性名或点号分隔的嵌套路径
+     */
+    explicit TActorPropertyHandle(const TCHAR* InPropertyPath)
+        : PropertyPath(InPropertyPath)
+    {
+    }
+
+    /**
+     * 检查路径是否存在且类型匹配
+     * @return 是否有效
+     */
+    bool IsValid() const
+    {
+        return Resolve() != nullptr;
+    }
+
+    /**
+     * 获取属性值地址
+     * @param Owner 目标Actor
+     * @return 值地址，句柄无效或途经的对象引用为空时返回nullptr
+     */
+    TValue* GetPtr(TOwner* Owner) const
+    {
+        const FActorPropertyPath* Path = Resolve();
+        if (!Path || !Owner)
+        {
+            return nullptr;
+        }
+
+        // 路径不经过对象引用时直接按偏移寻址
+        if (DirectOffset != INDEX_NONE)
+        {
+            return reinterpret_cast<TValue*>(reinterpret_cast<uint8*>(Owner) + DirectOffset);
+        }
+
+        return static_cast<TValue*>(Path->GetValuePtr(Owner));
+    }
+
+    const TValue* GetPtr(const TOwner* Owner) const
+    {
+        return GetPtr(const_cast<TOwner*>(Owner));
+    }
+
+    /**
+     * 读取属性值
+     * @param Owner 目标Actor
+     * @param DefaultValue 句柄无效时的返回值
+     * @return 属性值
+     */
+    TValue Get(const TOwner* Owner, const TValue& DefaultValue = TValue()) const
+    {
+        const TValue* ValuePtr = GetPtr(Owner);
+        return ValuePtr ? *ValuePtr : DefaultValue;
+    }
+
+    /**
+     * 写入属性值
+     * @param Owner 目标Actor
+     * @param Value 属性值
+     * @return 是否成功
+     */
+    bool Set(TOwner* Owner, const TValue& Value) const
+    {
+        TValue* ValuePtr = GetPtr(Owner);
+        if (!ValuePtr)
+        {
+            return false;
+        }
+
+        *ValuePtr = Value;
+        return true;
+    }
+
+private:
+    const FActorPropertyPath* Resolve() const
+    {
+        const uint32 CacheGeneration = ActorTestHelper::GetPropertyPathCacheGeneration();
+        if (ResolvedGeneration != CacheGeneration)
+        {
+            const FActorPropertyPath* Path = ActorTestHelper::ResolvePropertyPath(TOwner::StaticClass(), FName(PropertyPath));
+            ResolvedPath = (Path && TActorPropertyTypeTraits<TValue>::Matches(Path->LeafProperty)) ? Path : nullptr;
+            DirectOffset = (ResolvedPath && ResolvedPath->ObjectHops.Num() == 0) ? ResolvedPath->LeafOffset : INDEX_NONE;
+            ResolvedGeneration = CacheGeneration;
+        }
+
+        return ResolvedPath;
+    }
+
+    const TCHAR* PropertyPath;
+    mutable const FActorPropertyPath* ResolvedPath = nullptr;
+    mutable int32 DirectOffset = INDEX_NONE;
+    mutable uint32 ResolvedGeneration = 0;
+};
+
+/**
+ * FActorTestObjectState
+ * 单个对象（Actor或其组件）的序列化属性数据
+ */
+struct FActorTestObjectState
+{
+    TWeakObjectPtr<UObject> Object;
+    TArray<uint8> PropertyData;
+};
+
+/**
+ * FActorTestWorldSnapshot
+ * 测试世界快照，记录快照时存在的Actor以及Actor和组件的属性数据
+ */
+struct FActorTestWorldSnapshot
+{
+    /** 快照时世界中存在的Actor */
+    TSet<TWeakObjectPtr<AActor>> Actors;
+
+    /** Actor及其组件的属性数据 */
+    TArray<FActorTestObjectState> ObjectStates;
+
+    /** 是否已捕获 */
+    bool bCaptured = false;
+};
+
+/**
+ * FActorTestHandle
+ * ActorTestSpawner生成的Actor句柄
+ * 带代数校验，槽位被回收复用后旧句柄自动失效
+ */
+struct FActorTestHandle
+{
+    int32 Index = INDEX_NONE;
+    uint32 Generation = 0;
+
+    bool IsSet() const
+    {
+        return Index != INDEX_NONE;
+    }
+
+    bool operator==(const FActorTestHandle& Other) const
+    {
+        return Index == Other.Index && Generation == Other.Generation;
+    }
+
+    bool operator!=(const FActorTestHandle& Other) const
+    {
+        return !(*this == Other);
+    }
 };
 
 /**
@@ -85,7 +522,7 @@ public:
     bool InitializeWorld();
 
     /**
-     * 销毁测试世界
+     * 销毁测试世界（同时清空Actor池和世界快照）
      */
     void DestroyWorld();
 
@@ -99,8 +536,20 @@ public:
     template<typename T>
     T* SpawnActor(const FVector& Location = FVector::ZeroVector, const FRotator& Rotation = FRotator::ZeroRotator);
 
+    /**
+     * 在测试世界中批量生成Actor
+     * 池化模式下优先复用池中实例，其余部分通过 ActorTestHelper::SpawnActorsBatch 延迟生成
+     * @tparam T Actor类型
+     * @param Count 生成数量
+     * @param LayoutFn 根据索引返回生成变换
+     * @return 生成的Actor数组
+     */
+    template<typename T>
+    TArray<T*> SpawnActorsBatch(int32 Count, TFunctionRef<FTransform(int32)> LayoutFn);
+
     /**
      * 销毁所有生成的Actor
+     * 池化模式下改为全部归还到池中
      */
     void DestroyAllSpawnedActors();
 
@@ -112,14 +561,233 @@ public:
 
     /**
      * 获取生成的Actor数量
+     * O(1)，包含被测试自行销毁但尚未回收的槽位，ForEachLiveActor 会回收这些槽位
      * @return Actor数量
      */
     int32 GetSpawnedActorCount() const;
 
+    /**
+     * 获取生成的Actor对应的句柄
+     * @param Actor 由本Spawner生成的Actor
+     * @return 句柄，Actor不由本Spawner管理时返回未设置的句柄
+     */
+    FActorTestHandle GetActorHandle(const AActor* Actor) const;
+
+    /**
+     * 检查句柄是否仍指向存活的Actor
+     * 槽位已回收或Actor已被销毁时返回false
+     * @param Handle Actor句柄
+     * @return 是否有效
+     */
+    bool IsHandleValid(FActorTestHandle Handle) const;
+
+    /**
+     * 通过句柄获取Actor
+     * @tparam T Actor类型
+     * @param Handle Actor句柄
+     * @return Actor指针，句柄失效或类型不符时返回nullptr
+     */
+    template<typename T = AActor>
+    T* ResolveHandle(FActorTestHandle Handle) const;
+
+    /**
+     * 通过句柄归还Actor，O(1)
+     * 池化模式下重置后放回池中，否则直接销毁
+     * @param Handle Actor句柄
+     * @return 是否成功
+     */
+    bool ReleaseActor(FActorTestHandle Handle);
+
+    /**
+     * 遍历所有存活的生成Actor
+     * 被测试自行销毁的Actor不会传给回调，其槽位在遍历中被回收
+     * @param Callback 对每个存活Actor调用
+     */
+    void ForEachLiveActor(TFunctionRef<void(AActor*)> Callback);
+
+    /**
+     * 以固定步长同步推进测试世界
+     * 直接调用World Tick（含TimerManager和Actor/组件Tick），不受帧率和垂直同步限制，
+     * 5秒模拟时间只需要毫秒级的实际耗时
+     * @param NumFrames 推进帧数
+     * @param FixedDeltaSeconds 每帧步长（秒）
+     */
+    void AdvanceWorld(int32 NumFrames, float FixedDeltaSeconds = 1.0f / 60.0f);
+
+    /**
+     * 以固定步长推进测试世界直到条件满足
+     * 推进前先检查一次条件，之后每帧推进后检查
+     * @param Predicate 条件
+     * @param MaxSimulatedSeconds 最长模拟时间（秒）
+     * @param FixedDeltaSeconds 每帧步长（秒）
+     * @return 条件是否在模拟时间内满足
+     */
+    bool AdvanceUntil(TFunctionRef<bool()> Predicate, float MaxSimulatedSeconds, float FixedDeltaSeconds = 1.0f / 60.0f);
+
+    /**
+     * 获取通过 AdvanceWorld/AdvanceUntil 累计推进的模拟时间
+     * @return 模拟时间（秒）
+     */
+    double GetSimulatedSeconds() const;
+
+    /**
+     * 获取通过 AdvanceWorld/AdvanceUntil 累计推进的帧数
+     * @return 帧数
+     */
+    uint64 GetSimulatedFrameCount() const;
+
+    /**
+     * 捕获测试世界快照
+     * 通常在BEFORE_ALL完成世界和公共Actor的准备后调用一次
+     * @return 是否成功
+     */
+    bool CaptureWorldSnapshot();
+
+    /**
+     * 按差异恢复到快照状态
+     * 销毁快照之后新增的Actor，只对属性发生变化的Actor和组件回写快照数据，不重建世界；
+     * 被销毁的Actor若由本Spawner生成，其槽位同时回收（代数递增，旧句柄失效），
+     * 恢复后 GetSpawnedActorCount 与捕获快照时一致；
+     * 池中的Actor只是隐藏，仍在世界中，快照之后进入池的Actor同样被销毁，并从Actor池中移除
+     * @return 被销毁或回写的对象数量，无快照时返回INDEX_NONE
+     */
+    int32 RestoreWorldSnapshot();
+
+    /**
+     * 是否已有快照
+     * @return 是否已捕获
+     */
+    bool HasWorldSnapshot() const;
+
+    /**
+     * 丢弃当前快照
+     */
+    void DiscardWorldSnapshot();
+
+    /**
+     * 启用或禁用池化模式
+     * 池化模式下归还的Actor不会被销毁，而是重置后按类放回池中，
+     * 下一次 SpawnActor<T> 优先复用池中的实例
+     * @param bEnable 是否启用
+     */
+    void SetPoolingEnabled(bool bEnable);
+
+    /**
+     * 是否处于池化模式
+     * @return 是否启用
+     */
+    bool IsPoolingEnabled() const;
+
+    /**
+     * 归还单个生成的Actor
+     * 池化模式下重置后放回池中，否则直接销毁；按Actor查找槽位为O(1)
+     * @param Actor 要归还的Actor
+     * @return 是否成功
+     */
+    bool ReleaseActor(AActor* Actor);
+
+    /**
+     * 销毁池中所有Actor并清空Actor池
+     */
+    void ClearActorPool();
+
+    /**
+     * 获取池中空闲Actor数量
+     * @return 空闲Actor数量
+     */
+    int32 GetPooledActorCount() const;
+
+    /**
+     * 获取池命中次数（SpawnActor复用了池中实例）
+     * @return 命中次数
+     */
+    int32 GetPoolHitCount() const;
+
+    /**
+     * 获取池未命中次数（池中无可用实例，回退为真实生成）
+     * @return 未命中次数
+     */
+    int32 GetPoolMissCount() const;
+
+    /**
+     * 重置池命中/未命中计数
+     */
+    void ResetPoolStats();
+
 private:
+    typedef void (*FPoolResetFunc)(AActor*);
+
+    /**
+     * 生成Actor的槽位，空闲时通过NextFreeSlot串成空闲链表
+     */
+    struct FSpawnedActorSlot
+    {
+        TWeakObjectPtr<AActor> Actor;
+        uint32 Generation = 1;
+        int32 NextFreeSlot = INDEX_NONE;
+        bool bOccupied = false;
+    };
+
+    /**
+     * 为Actor分配槽位（优先复用空闲链表），O(1)
+     * @return 新句柄
+     */
+    FActorTestHandle AddSpawnedActor(AActor* Actor);
+
+    /**
+     * 释放槽位并递增代数，使旧句柄失效，O(1)
+     */
+    void RemoveSpawnedActor(FActorTestHandle Handle);
+
+    /**
+     * 为即将生成的Actor预留槽位和索引容量
+     */
+    void ReserveSpawnedActors(int32 NumToAdd);
+
+    /**
+     * 校验代数后取得槽位中的Actor，不会访问已销毁的对象
+     */
+    AActor* GetSlotActor(FActorTestHandle Handle) const;
+
+    /**
+     * 从池中取出指定类的Actor并放置到目标位置，同时更新命中/未命中计数
+     * 已被销毁的池条目被跳过并移除
+     * @return 池中Actor，池为空时返回nullptr
+     */
+    AActor* AcquirePooledActor(UClass* ActorClass, const FVector& Location, const FRotator& Rotation);
+
+    /**
+     * 调用该类注册的重置钩子，隐藏并停用Actor后放回池中
+     */
+    void ReturnToPool(AActor* Actor);
+
+    /**
+     * 序列化对象属性到缓冲区，用于捕获快照和检测差异
+     */
+    static void SerializeObjectState(UObject* Object, TArray<uint8>& OutData);
+
     UWorld* TestWorld;
-    TArray<AActor*> SpawnedActors;
     bool bWorldInitialized;
+
+    // 生成Actor的槽位表，少量Actor时不分配堆内存
+    TArray<FSpawnedActorSlot, TInlineAllocator<32>> SpawnedActorSlots;
+    TMap<TObjectKey<AActor>, int32> SpawnedActorSlotIndices;
+    int32 FirstFreeSlot;
+    int32 NumSpawnedActors;
+
+    // 快进Tick
+    double SimulatedSeconds;
+    uint64 SimulatedFrameCount;
+
+    // 世界快照
+    FActorTestWorldSnapshot WorldSnapshot;
+
+    // 池化状态：弱引用，池中Actor被世界快照恢复或测试自行销毁后不会被访问
+    TMap<UClass*, TArray<TWeakObjectPtr<AActor>>> ActorPool;
+    TMap<UClass*, FPoolResetFunc> PoolResetHooks;
+    int32 PoolHitCount;
+    int32 PoolMissCount;
+    bool bPoolingEnabled;
 };
 
 // 模板实现
@@ -134,6 +802,114 @@ T* ActorTestHelper::SpawnActor(UWorld* World, const FVector& Location, const FRo
     return World->SpawnActor<T>(Location, Rotation);
 }
 
+template<typename TValue, typename>
+bool ActorTestHelper::SetActorPropertyTyped(AActor* Actor, const FName& PropertyPath, const TValue& Value)
+{
+    if (!Actor)
+    {
+        return false;
+    }
+
+    const FActorPropertyPath* Path = ResolvePropertyPath(Actor->GetClass(), PropertyPath);
+    if (!Path || !TActorPropertyTypeTraits<TValue>::Matches(Path->LeafProperty))
+    {
+        return false;
+    }
+
+    TValue* ValuePtr = static_cast<TValue*>(Path->GetValuePtr(Actor));
+    if (!ValuePtr)
+    {
+        return false;
+    }
+
+    *ValuePtr = Value;
+    return true;
+}
+
+template<typename TValue, typename>
+bool ActorTestHelper::GetActorPropertyTyped(AActor* Actor, const FName& PropertyPath, TValue& OutValue)
+{
+    if (!Actor)
+    {
+        return false;
+    }
+
+    const FActorPropertyPath* Path = ResolvePropertyPath(Actor->GetClass(), PropertyPath);
+    if (!Path || !TActorPropertyTypeTraits<TValue>::Matches(Path->LeafProperty))
+    {
+        return false;
+    }
+
+    const TValue* ValuePtr = static_cast<const TValue*>(Path->GetValuePtr(Actor));
+    if (!ValuePtr)
+    {
+        return false;
+    }
+
+    OutValue = *ValuePtr;
+    return true;
+}
+
+template<typename TValue>
+bool FActorPropertySet::Add(const FName& PropertyPath, const TValue& Value)
+{
+    static_assert(TActorPropertyTypeTraits<TValue>::bSupported, "Unsupported property value type");
+
+    const FActorPropertyPath* Path = ActorTestHelper::ResolvePropertyPath(ActorClass, PropertyPath);
+    if (!Path || !TActorPropertyTypeTraits<TValue>::Matches(Path->LeafProperty))
+    {
+        return false;
+    }
+
+    FEntry* Entry = Entries.FindByPredicate([Path](const FEntry& Existing) { return Existing.Path == Path; });
+    if (!Entry)
+    {
+        Entry = &Entries.AddDefaulted_GetRef();
+        Entry->Path = Path;
+        Entry->Value.SetNumZeroed(Path->LeafProperty->GetSize());
+        Path->LeafProperty->InitializeValue(Entry->Value.GetData());
+    }
+
+    *reinterpret_cast<TValue*>(Entry->Value.GetData()) = Value;
+    return true;
+}
+
+template<typename T>
+TArray<T*> ActorTestHelper::SpawnActorsBatch(UWorld* World, int32 Count, TFunctionRef<FTransform(int32)> LayoutFn)
+{
+    TArray<T*> Actors;
+    if (!World || Count <= 0)
+    {
+        return Actors;
+    }
+
+    TArray<FTransform> Transforms;
+    Actors.Reserve(Count);
+    Transforms.Reserve(Count);
+
+    // 批量期间推迟导航八叉树更新，解锁时统一处理
+    FNavigationLockContext NavigationLock(World, ENavigationLockReason::Unknown);
+
+    // 第一遍：只创建Actor对象，不执行构造脚本和BeginPlay
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        const FTransform Transform = LayoutFn(Index);
+        if (T* Actor = World->SpawnActorDeferred<T>(T::StaticClass(), Transform))
+        {
+            Actors.Add(Actor);
+            Transforms.Add(Transform);
+        }
+    }
+
+    // 第二遍：集中完成生成
+    for (int32 Index = 0; Index < Actors.Num(); ++Index)
+    {
+        Actors[Index]->FinishSpawning(Transforms[Index]);
+    }
+
+    return Actors;
+}
+
 template<typename T>
 T* ActorTestSpawner::SpawnActor(const FVector& Location, const FRotator& Rotation)
 {
@@ -142,11 +918,78 @@ T* ActorTestSpawner::SpawnActor(const FVector& Location, const FRotator& Rotatio
         return nullptr;
     }
 
+    if (bPoolingEnabled)
+    {
+        PoolResetHooks.FindOrAdd(T::StaticClass(), &TActorTestPoolTraits<T>::ResetForPool);
+
+        if (AActor* PooledActor = AcquirePooledActor(T::StaticClass(), Location, Rotation))
+        {
+            AddSpawnedActor(PooledActor);
+            return CastChecked<T>(PooledActor);
+        }
+    }
+
     T* Actor = ActorTestHelper::SpawnActor<T>(TestWorld, Location, Rotation);
     if (Actor)
     {
-        SpawnedActors.Add(Actor);
+        AddSpawnedActor(Actor);
     }
 
     return Actor;
 }
+
+template<typename T>
+TArray<T*> ActorTestSpawner::SpawnActorsBatch(int32 Count, TFunctionRef<FTransform(int32)> LayoutFn)
+{
+    TArray<T*> Actors;
+    if (!TestWorld || !bWorldInitialized || Count <= 0)
+    {
+        return Actors;
+    }
+
+    Actors.Reserve(Count);
+    ReserveSpawnedActors(Count);
+
+    int32 NumReused = 0;
+    if (bPoolingEnabled)
+    {
+        PoolResetHooks.FindOrAdd(T::StaticClass(), &TActorTestPoolTraits<T>::ResetForPool);
+
+        // 先移除已销毁的条目，保证取出的数量与可用数量一致
+        TArray<TWeakObjectPtr<AActor>>* Pool = ActorPool.Find(T::StaticClass());
+        if (Pool)
+        {
+            Pool->RemoveAll([](const TWeakObjectPtr<AActor>& Entry) { return !Entry.IsValid(); });
+        }
+
+        const int32 NumAvailable = Pool ? FMath::Min(Pool->Num(), Count) : 0;
+        for (; NumReused < NumAvailable; ++NumReused)
+        {
+            // AcquirePooledActor 只设置位置和旋转，缩放需单独应用，与新生成的Actor保持一致
+            const FTransform Transform = LayoutFn(NumReused);
+            T* PooledActor = CastChecked<T>(AcquirePooledActor(T::StaticClass(), Transform.GetLocation(), Transform.Rotator()));
+            PooledActor->SetActorScale3D(Transform.GetScale3D());
+            Actors.Add(PooledActor);
+        }
+
+        PoolMissCount += Count - NumReused;
+    }
+
+    Actors.Append(ActorTestHelper::SpawnActorsBatch<T>(TestWorld, Count - NumReused, [&LayoutFn, NumReused](int32 Index)
+    {
+        return LayoutFn(NumReused + Index);
+    }));
+
+    for (T* Actor : Actors)
+    {
+        AddSpawnedActor(Actor);
+    }
+
+    return Actors;
+}
+
+template<typename T>
+T* ActorTestSpawner::ResolveHandle(FActorTestHandle Handle) const
+{
+    return Cast<T>(GetSlotActor(Handle));
+}
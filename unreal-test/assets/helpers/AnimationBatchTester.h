@@ -0,0 +1,193 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Animation/AnimInstance.h"
+#include "Animation/AnimMontage.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "UObject/GCObject.h"
+#include "Helpers/AnimationTestHelper.h"
+
+/**
+ * FAnimationBatchCase
+ * 批量测试中的一个组合：骨骼网格、动画蓝图和要播放的蒙太奇
+ */
+struct FAnimationBatchCase
+{
+    /** 组合名称，用于报告 */
+    FString Name;
+
+    /** 骨骼网格 */
+    USkeletalMesh* Mesh = nullptr;
+
+    /** 动画蓝图类 */
+    TSubclassOf<UAnimInstance> AnimClass;
+
+    /** 要播放的蒙太奇，为nullptr时只运行状态机 */
+    UAnimMontage* Montage = nullptr;
+
+    /** 蒙太奇播放速率 */
+    float PlayRate = 1.0f;
+
+    /** 初始动画状态，NAME_None表示不设置 */
+    FName InitialState = NAME_None;
+};
+
+/**
+ * FAnimationBatchTimings
+ * 单个实例的累计耗时
+ */
+struct FAnimationBatchTimings
+{
+    /** 推进的帧数 */
+    int32 Frames = 0;
+
+    /** 工作线程上的动画更新耗时（秒） */
+    double UpdateSeconds = 0.0;
+
+    /** 工作线程上的姿势求值耗时（秒） */
+    double EvaluateSeconds = 0.0;
+
+    /** 游戏线程上的更新前后处理和通知派发耗时（秒） */
+    double GameThreadSeconds = 0.0;
+
+    /** 因动画蓝图不支持多线程更新而在游戏线程上更新的帧数 */
+    int32 GameThreadFallbackFrames = 0;
+};
+
+/**
+ * AnimationBatchTester
+ * 同时驱动多个动画实例，用于批量回归测试大量角色与蒙太奇组合
+ * 每一步分三个阶段：
+ *   1. 游戏线程：所有实例的 PreUpdateAnimation
+ *   2. ParallelFor：各实例在工作线程上执行 ParallelUpdateAnimation 和姿势求值
+ *      （动画蓝图不支持多线程更新的实例回退到游戏线程，并计入 GameThreadFallbackFrames）
+ *   3. 游戏线程：按实例顺序执行 PostUpdateAnimation 并派发通知，事件写入各实例的 FAnimationEventRecorder
+ * 不依赖世界Tick，实例之间互不影响，结果与实例数量和线程调度无关
+ * 作为 FGCObject 引用各实例的组件、骨骼网格和蒙太奇，测试期间发生GC也不会回收
+ */
+class AnimationBatchTester : public FGCObject
+{
+public:
+    /**
+     * 构造函数
+     * @param InWorld 用于注册骨骼网格组件的世界
+     * @param InEventCapacity 每个实例的事件缓冲区容量
+     */
+    explicit AnimationBatchTester(UWorld* InWorld, int32 InEventCapacity = 256);
+    virtual ~AnimationBatchTester();
+
+    AnimationBatchTester(const AnimationBatchTester&) = delete;
+    AnimationBatchTester& operator=(const AnimationBatchTester&) = delete;
+
+    /**
+     * 预留实例容量
+     * @param NumCases 组合数量
+     */
+    void Reserve(int32 NumCases);
+
+    /**
+     * 添加组合：创建骨骼网格组件和动画实例，设置初始状态并开始播放蒙太奇
+     * @param Case 组合
+     * @return 实例序号，创建失败为INDEX_NONE
+     */
+    int32 AddCase(const FAnimationBatchCase& Case);
+
+    /**
+     * 推进所有实例
+     * @param DeltaSeconds 每步时长（秒）
+     * @param Steps 步数
+     */
+    void Step(float DeltaSeconds, int32 Steps = 1);
+
+    /**
+     * 推进直到所有蒙太奇结束或达到模拟时长上限
+     * @param DeltaSeconds 每步时长（秒）
+     * @param MaxSimulatedSeconds 模拟时长上限（秒）
+     * @return 是否所有蒙太奇都已结束
+     */
+    bool RunUntilMontagesComplete(float DeltaSeconds = 1.0f / 60.0f, float MaxSimulatedSeconds = 30.0f);
+
+    /**
+     * 获取实例数量
+     * @return 实例数量
+     */
+    int32 Num() const;
+
+    /**
+     * 获取实例的组合描述
+     * @param Index 实例序号
+     * @return 组合
+     */
+    const FAnimationBatchCase& GetCase(int32 Index) const;
+
+    /**
+     * 获取实例的Helper，用于单独查询状态
+     * @param Index 实例序号
+     * @return Helper
+     */
+    AnimationTestHelper& GetHelper(int32 Index) const;
+
+    /**
+     * 获取实例的事件记录
+     * @param Index 实例序号
+     * @return 事件记录
+     */
+    const FAnimationEventRecorder& GetRecorder(int32 Index) const;
+
+    /**
+     * 获取实例的累计耗时
+     * @param Index 实例序号
+     * @return 耗时
+     */
+    const FAnimationBatchTimings& GetTimings(int32 Index) const;
+
+    /**
+     * 获取所有步骤的总耗时（墙钟时间）
+     * @return 耗时（秒）
+     */
+    double GetTotalSeconds() const;
+
+    /**
+     * 输出每个实例的帧数、耗时、回退帧数和事件数到日志，按总耗时降序
+     */
+    void LogSummary() const;
+
+    /**
+     * 销毁所有实例
+     */
+    void Reset();
+
+    // FGCObject
+    virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+    virtual FString GetReferencerName() const override;
+
+private:
+    /**
+     * 单个实例：组件、Helper、事件记录和耗时
+     */
+    struct FInstance
+    {
+        /** 组合，Mesh和Montage由 AddReferencedObjects 引用 */
+        FAnimationBatchCase Case;
+
+        /** 骨骼网格组件，由 AddReferencedObjects 引用 */
+        USkeletalMeshComponent* Component = nullptr;
+
+        TUniquePtr<AnimationTestHelper> Helper;
+        TUniquePtr<FAnimationEventRecorder> Recorder;
+        FAnimationBatchTimings Timings;
+
+        /** 动画蓝图是否支持在工作线程上更新 */
+        bool bCanUpdateOnWorker = true;
+    };
+
+    /**
+     * 阶段2：在当前线程上更新并求值一个实例
+     */
+    void UpdateAndEvaluate(FInstance& Instance, float DeltaSeconds);
+
+    TWeakObjectPtr<UWorld> World;
+    TArray<TUniquePtr<FInstance>> Instances;
+    int32 EventCapacity;
+    double TotalSeconds;
+};
@@ -4,9 +4,14 @@
 #include "Animation/AnimInstance.h"
 #include "Animation/AnimMontage.h"
 #include "Delegates/DelegateCombinations.h"
+#include "Math/VectorRegister.h"
+#include "Helpers/BenchmarkTestHelper.h"
 
 // 前向声明
 class UAnimInstance;
+class FPoseSnapshotSoA;
+class FAnimationBenchmarkScript;
+struct FAnimationBenchmarkResult;
 
 /**
  * AnimationTestHelper
@@ -103,6 +108,53 @@ public:
      */
     bool WaitForMontagePosition(float TargetPosition, float Timeout = 5.0f);
 
+    /**
+     * 离线求值蒙太奇在指定时间的姿势
+     * 不依赖世界Tick：蒙太奇未播放时先开始播放，跳转到目标时间后同步执行一次动画更新和姿势求值
+     * 跳转跨过的通知不会触发，需要验证通知时使用 StepMontage
+     * @param Montage 要求值的蒙太奇
+     * @param Time 蒙太奇时间（秒）
+     * @return 是否成功（蒙太奇有效且时间在蒙太奇长度内）
+     */
+    bool EvaluateMontageAt(UAnimMontage* Montage, float Time);
+
+    /**
+     * 以固定步长同步推进动画
+     * 每一步在游戏线程上依次执行动画更新、姿势求值和通知派发，不依赖世界Tick，
+     * 步长内经过的通知按时间顺序触发 OnNotifyBegin/OnNotifyEnd，蒙太奇结束时触发 OnMontageEnded
+     * @param DeltaSeconds 每步时长（秒）
+     * @param Steps 步数
+     * @return 实际推进的步数，当前蒙太奇结束后提前停止
+     */
+    int32 StepMontage(float DeltaSeconds, int32 Steps = 1);
+
+    /**
+     * 获取动画帧序号
+     * 世界Tick驱动时为动画实例的更新次数，StepMontage 每推进一步加1
+     * @return 帧序号
+     */
+    uint32 GetAnimationFrame() const;
+
+    /**
+     * 在指定的蒙太奇时间捕获组件空间骨骼变换
+     * 每个时间点通过 EvaluateMontageAt 离线求值，结果按帧写入快照
+     * @param Montage 要捕获的蒙太奇
+     * @param Times 蒙太奇时间（秒）
+     * @param OutSnapshot 输出快照，按骨骼数量和时间点数量重新分配
+     * @return 是否所有时间点都捕获成功
+     */
+    bool CapturePose(UAnimMontage* Montage, TArrayView<const float> Times, FPoseSnapshotSoA& OutSnapshot);
+
+    /**
+     * 基准测试模式：按脚本以固定步长同步推进动画，分别计时每帧的动画更新、姿势求值和通知派发
+     * 动画蓝图支持多线程更新时，更新在工作线程上执行（与运行时一致），回退到游戏线程的帧单独记录
+     * @param Script 脚本（状态切换、蒙太奇播放和推进帧数）
+     * @param DeltaSeconds 每帧时长（秒）
+     * @param Repetitions 脚本重复次数，重复之间停止蒙太奇
+     * @return 基准测试结果
+     */
+    FAnimationBenchmarkResult RunBenchmark(const FAnimationBenchmarkScript& Script, float DeltaSeconds = 1.0f / 60.0f, int32 Repetitions = 1);
+
     /**
      * 获取当前动画状态
      * @return 状态名称
@@ -142,6 +194,7 @@ public:
 private:
     UAnimInstance* AnimInstance;
     UAnimMontage* CurrentMontage;
+    uint32 AnimationFrame;
     bool bInitialized;
 
     /**
@@ -153,4 +206,558 @@ private:
      * 内部清理
      */
     void InternalCleanup();
+
+    /**
+     * 同步执行一步动画更新、姿势求值和通知派发
+     * 临时关闭并行动画更新与求值，保证通知在本次调用内派发
+     * @param DeltaSeconds 时长（秒），0表示只求值当前姿势
+     */
+    void TickAnimationSynchronously(float DeltaSeconds);
+};
+
+/**
+ * FAnimationBenchmarkScript
+ * 基准测试脚本：按顺序执行的状态切换、蒙太奇播放和推进步骤
+ *   FAnimationBenchmarkScript Script;
+ *   Script.SetState(TEXT("Run")).Advance(60).PlayMontage(Attack, 1.5f).Advance(90);
+ */
+class FAnimationBenchmarkScript
+{
+public:
+    /** 脚本步骤 */
+    struct FStep
+    {
+        enum class EType : uint8
+        {
+            SetState,
+            PlayMontage,
+            Advance
+        };
+
+        EType Type = EType::Advance;
+        FName StateName = NAME_None;
+        UAnimMontage* Montage = nullptr;
+        float PlayRate = 1.0f;
+        int32 Frames = 0;
+    };
+
+    /**
+     * 切换动画状态（AnimationTestHelper::SetAnimationState）
+     * @param StateName 状态名称
+     * @return 脚本，便于继续链式调用
+     */
+    FAnimationBenchmarkScript& SetState(FName StateName)
+    {
+        FStep& Step = Steps.AddDefaulted_GetRef();
+        Step.Type = FStep::EType::SetState;
+        Step.StateName = StateName;
+        return *this;
+    }
+
+    /**
+     * 播放蒙太奇（AnimationTestHelper::PlayMontage）
+     * @param Montage 蒙太奇
+     * @param PlayRate 播放速率
+     * @return 脚本，便于继续链式调用
+     */
+    FAnimationBenchmarkScript& PlayMontage(UAnimMontage* Montage, float PlayRate = 1.0f)
+    {
+        FStep& Step = Steps.AddDefaulted_GetRef();
+        Step.Type = FStep::EType::PlayMontage;
+        Step.Montage = Montage;
+        Step.PlayRate = PlayRate;
+        return *this;
+    }
+
+    /**
+     * 推进指定帧数，只有推进的帧参与计时
+     * @param Frames 帧数
+     * @return 脚本，便于继续链式调用
+     */
+    FAnimationBenchmarkScript& Advance(int32 Frames)
+    {
+        FStep& Step = Steps.AddDefaulted_GetRef();
+        Step.Type = FStep::EType::Advance;
+        Step.Frames = Frames;
+        return *this;
+    }
+
+    /**
+     * 获取总帧数
+     * @return 所有Advance步骤的帧数之和
+     */
+    int32 GetTotalFrames() const
+    {
+        int32 Total = 0;
+        for (const FStep& Step : Steps)
+        {
+            Total += Step.Frames;
+        }
+        return Total;
+    }
+
+    const TArray<FStep>& GetSteps() const
+    {
+        return Steps;
+    }
+
+private:
+    TArray<FStep> Steps;
+};
+
+/**
+ * FAnimationBenchmarkResult
+ * 动画基准测试结果，每项统计的单位为每帧耗时（秒）
+ * 统计量可以直接交给 FTestBenchmarkReporter::Report 或 ASSERT_PERF
+ */
+struct FAnimationBenchmarkResult
+{
+    /** 动画更新（NativeUpdateAnimation、状态机和混合树） */
+    FTestBenchmarkStats Update;
+
+    /** 姿势求值 */
+    FTestBenchmarkStats Evaluate;
+
+    /** 通知派发 */
+    FTestBenchmarkStats NotifyDispatch;
+
+    FTestHistogram UpdateHistogram;
+    FTestHistogram EvaluateHistogram;
+    FTestHistogram NotifyDispatchHistogram;
+
+    /** 计时的总帧数 */
+    int32 NumFrames = 0;
+
+    /** 从工作线程更新回退到游戏线程的帧序号 */
+    TArray<int32> GameThreadFallbackFrames;
+
+    /**
+     * 输出统计和直方图到测试日志，回退帧数大于0时报告警告
+     * @param TestRunner 测试实例
+     */
+    void Report(FAutomationTestBase& TestRunner) const;
+};
+
+/**
+ * EAnimationEventType
+ * 动画事件类型
+ */
+enum class EAnimationEventType : uint8
+{
+    MontageBlendingOut,
+    MontageEnded,
+    NotifyBegin,
+    NotifyEnd
+};
+
+/**
+ * FAnimationEventRecord
+ * 单个动画事件记录，定长，不持有堆内存
+ */
+struct FAnimationEventRecord
+{
+    /** 事件所属的蒙太奇 */
+    const UAnimMontage* Montage = nullptr;
+
+    /** 通知名称，蒙太奇事件为NAME_None */
+    FName NotifyName;
+
+    /** 事件发生时的蒙太奇位置（秒） */
+    float Position = 0.0f;
+
+    /** 事件发生时的动画帧序号（AnimationTestHelper::GetAnimationFrame） */
+    uint32 Frame = 0;
+
+    /** 事件类型 */
+    EAnimationEventType Type = EAnimationEventType::NotifyBegin;
+
+    /** 蒙太奇是否被打断，仅对蒙太奇事件有效 */
+    bool bInterrupted = false;
+};
+
+/**
+ * FAnimationEventRecorder
+ * 订阅 AnimationTestHelper 的蒙太奇和通知委托，把每个事件追加到预分配的环形缓冲区
+ * 记录时不分配内存；缓冲区满后覆盖最早的事件并计入丢弃数量
+ * 一次播放后可以对同一份记录做任意多次时序断言，或导出为二进制文件与黄金文件比较
+ */
+class FAnimationEventRecorder
+{
+public:
+    /**
+     * 构造函数，立即开始记录
+     * @param InHelper 要记录的Helper，必须比Recorder存活更久
+     * @param InCapacity 缓冲区容量（事件数），小于1时按1处理
+     */
+    explicit FAnimationEventRecorder(AnimationTestHelper& InHelper, int32 InCapacity = 1024);
+    ~FAnimationEventRecorder();
+
+    FAnimationEventRecorder(const FAnimationEventRecorder&) = delete;
+    FAnimationEventRecorder& operator=(const FAnimationEventRecorder&) = delete;
+
+    /**
+     * 清空记录，不释放缓冲区
+     */
+    void Reset()
+    {
+        Head = 0;
+        Count = 0;
+        DroppedCount = 0;
+    }
+
+    /**
+     * 获取记录数量
+     * @return 缓冲区中的事件数
+     */
+    int32 Num() const
+    {
+        return Count;
+    }
+
+    /**
+     * 获取因缓冲区已满被覆盖的事件数量
+     * @return 丢弃数量，非0时查询结果不完整
+     */
+    int32 GetDroppedCount() const
+    {
+        return DroppedCount;
+    }
+
+    /**
+     * 按时间顺序访问记录
+     * @param Index 序号，0为最早的事件
+     * @return 事件记录
+     */
+    const FAnimationEventRecord& operator[](int32 Index) const
+    {
+        check(Index >= 0 && Index < Count);
+        return Buffer[(Head + Index) % Buffer.Num()];
+    }
+
+    /**
+     * 追加一条记录
+     * @param Record 事件记录
+     */
+    FORCEINLINE void Append(const FAnimationEventRecord& Record)
+    {
+        const int32 Capacity = Buffer.Num();
+        check(Capacity > 0);
+        if (Count < Capacity)
+        {
+            Buffer[(Head + Count) % Capacity] = Record;
+            ++Count;
+        }
+        else
+        {
+            Buffer[Head] = Record;
+            Head = (Head + 1) % Capacity;
+            ++DroppedCount;
+        }
+    }
+
+    /**
+     * 通知是否在指定位置区间内触发
+     * @param NotifyName 通知名称
+     * @param StartPosition 区间起点（秒，含）
+     * @param EndPosition 区间终点（秒，含）
+     * @param Type 事件类型，默认为通知开始
+     * @return 是否触发
+     */
+    bool NotifyFiredBetween(FName NotifyName, float StartPosition, float EndPosition, EAnimationEventType Type = EAnimationEventType::NotifyBegin) const;
+
+    /**
+     * 统计事件数量
+     * @param Type 事件类型
+     * @param NotifyName 通知名称，NAME_None表示不限
+     * @return 事件数量
+     */
+    int32 CountEvents(EAnimationEventType Type, FName NotifyName = NAME_None) const;
+
+    /**
+     * 查找第一个匹配的事件
+     * @param Type 事件类型
+     * @param NotifyName 通知名称，NAME_None表示不限
+     * @return 事件序号，未找到为INDEX_NONE
+     */
+    int32 FindFirst(EAnimationEventType Type, FName NotifyName = NAME_None) const;
+
+    /**
+     * 通知是否按给定顺序开始（允许中间夹有其他事件）
+     * @param NotifyNames 期望的通知顺序
+     * @return 是否按顺序触发
+     */
+    bool NotifiesFiredInOrder(TArrayView<const FName> NotifyNames) const;
+
+    /**
+     * 序列化为紧凑的二进制格式
+     * 文件头之后是名称表（蒙太奇路径与通知名），记录中的名称以名称表序号保存
+     * @param OutBytes 输出
+     */
+    void Serialize(TArray<uint8>& OutBytes) const;
+
+    /**
+     * 写入二进制文件
+     * @param FilePath 文件路径
+     * @return 是否成功
+     */
+    bool SaveToFile(const FString& FilePath) const;
+
+    /**
+     * 与黄金文件比较：事件类型、蒙太奇、通知名和顺序必须一致，位置允许误差，帧序号不参与比较
+     * 命令行带 -UpdateAnimGoldens 时不做比较，写入当前记录并返回true
+     * 未带该开关且黄金文件不存在或无法读取时返回false，OutDiff 给出路径，避免路径错误的测试在CI中一直通过
+     * @param GoldenFilePath 黄金文件路径
+     * @param PositionTolerance 位置误差（秒）
+     * @param OutDiff 第一个差异的描述，或黄金文件缺失的说明
+     * @return 是否一致
+     */
+    bool MatchesGolden(const FString& GoldenFilePath, float PositionTolerance, FString& OutDiff) const;
+
+private:
+    void HandleBlendingOut(UAnimMontage* Montage, bool bInterrupted);
+    void HandleMontageEnded(UAnimMontage* Montage, bool bInterrupted);
+    void HandleNotifyBegin(FName NotifyName, const FBranchingPointNotifyPayload& Payload);
+    void HandleNotifyEnd(FName NotifyName, const FBranchingPointNotifyPayload& Payload);
+
+    AnimationTestHelper& Helper;
+    TArray<FAnimationEventRecord> Buffer;
+    int32 Head;
+    int32 Count;
+    int32 DroppedCount;
+    FDelegateHandle BlendingOutHandle;
+    FDelegateHandle EndedHandle;
+    FDelegateHandle NotifyBeginHandle;
+    FDelegateHandle NotifyEndHandle;
+};
+
+/**
+ * FPoseToleranceSettings
+ * 姿势比较的逐骨骼容差
+ */
+struct FPoseToleranceSettings
+{
+    /** 平移误差（厘米） */
+    float TranslationTolerance = 0.1f;
+
+    /** 旋转误差（度） */
+    float RotationToleranceDegrees = 0.5f;
+
+    /** 缩放误差（每个分量的绝对差） */
+    float ScaleTolerance = 0.001f;
 };
+
+/**
+ * FPoseCompareResult
+ * 单帧姿势比较结果
+ */
+struct FPoseCompareResult
+{
+    /** 超出容差的骨骼数量 */
+    int32 NumMismatchedBones = 0;
+
+    /** 第一个超出容差的骨骼序号，全部匹配时为INDEX_NONE */
+    int32 FirstMismatchedBone = INDEX_NONE;
+
+    /** 最大平移误差（厘米） */
+    float MaxTranslationError = 0.0f;
+
+    /** 最大旋转误差（度） */
+    float MaxRotationErrorDegrees = 0.0f;
+
+    /** 最大缩放误差 */
+    float MaxScaleError = 0.0f;
+
+    bool IsMatch() const
+    {
+        return NumMismatchedBones == 0;
+    }
+};
+
+/**
+ * FPoseSnapshotSoA
+ * 多帧组件空间骨骼变换快照，按SoA布局存储
+ * 每帧10个分量流（平移XYZ、旋转XYZW、缩放XYZ），每个流按4骨骼对齐填充，
+ * 填充部分为单位变换，比较时一次处理4根骨骼且不需要处理余数
+ */
+class FPoseSnapshotSoA
+{
+public:
+    /** 分量流 */
+    enum EStream : int32
+    {
+        TranslationX, TranslationY, TranslationZ,
+        RotationX, RotationY, RotationZ, RotationW,
+        ScaleX, ScaleY, ScaleZ,
+        NumStreams
+    };
+
+    /**
+     * 重新分配并填充为单位变换
+     * @param InNumBones 骨骼数量
+     * @param InNumFrames 帧数
+     */
+    void Reset(int32 InNumBones, int32 InNumFrames);
+
+    /**
+     * 写入一帧
+     * @param FrameIndex 帧序号
+     * @param Time 该帧对应的蒙太奇时间（秒）
+     * @param ComponentSpaceTransforms 组件空间骨骼变换，数量必须等于骨骼数量
+     */
+    void SetFrame(int32 FrameIndex, float Time, TArrayView<const FTransform> ComponentSpaceTransforms);
+
+    int32 GetNumBones() const
+    {
+        return NumBones;
+    }
+
+    int32 GetNumFrames() const
+    {
+        return FrameTimes.Num();
+    }
+
+    /**
+     * 获取帧对应的蒙太奇时间
+     * @param FrameIndex 帧序号
+     * @return 时间（秒）
+     */
+    float GetFrameTime(int32 FrameIndex) const
+    {
+        return FrameTimes[FrameIndex];
+    }
+
+    /**
+     * 获取一帧中的分量流，长度为4的倍数，16字节对齐
+     * @param FrameIndex 帧序号
+     * @param Stream 分量
+     * @return 流的首地址
+     */
+    const float* GetStream(int32 FrameIndex, EStream Stream) const
+    {
+        return Data.GetData() + (static_cast<SIZE_T>(FrameIndex) * NumStreams + Stream) * PaddedBones;
+    }
+
+    /**
+     * 向量化比较两帧姿势
+     * 每次处理4根骨骼：平移比较距离平方，旋转比较 |dot(Qa, Qb)| >= cos(容差/2)，缩放比较各分量绝对差
+     * @param A 快照A
+     * @param FrameA A中的帧序号
+     * @param B 快照B，骨骼数量必须与A一致
+     * @param FrameB B中的帧序号
+     * @param Settings 容差
+     * @return 比较结果
+     */
+    static FPoseCompareResult CompareFrame(const FPoseSnapshotSoA& A, int32 FrameA, const FPoseSnapshotSoA& B, int32 FrameB, const FPoseToleranceSettings& Settings);
+
+    /**
+     * 写入二进制文件
+     * @param FilePath 文件路径
+     * @return 是否成功
+     */
+    bool SaveToFile(const FString& FilePath) const;
+
+    /**
+     * 从二进制文件读取
+     * @param FilePath 文件路径
+     * @return 是否成功
+     */
+    bool LoadFromFile(const FString& FilePath);
+
+    /**
+     * 与黄金姿势文件逐帧比较，帧数和骨骼数量必须一致
+     * 命令行带 -UpdateAnimGoldens 时不做比较，写入当前快照并返回true
+     * 未带该开关且黄金文件不存在或无法读取时返回false，OutDiff 给出路径
+     * @param GoldenFilePath 黄金文件路径
+     * @param Settings 容差
+     * @param OutDiff 第一个不匹配帧的描述（帧序号、时间、骨骼序号和最大误差），或黄金文件缺失的说明
+     * @return 是否一致
+     */
+    bool MatchesGolden(const FString& GoldenFilePath, const FPoseToleranceSettings& Settings, FString& OutDiff) const;
+
+private:
+    float* GetMutableStream(int32 FrameIndex, EStream Stream)
+    {
+        return Data.GetData() + (static_cast<SIZE_T>(FrameIndex) * NumStreams + Stream) * PaddedBones;
+    }
+
+    int32 NumBones = 0;
+    int32 PaddedBones = 0;
+    TArray<float> FrameTimes;
+    TArray<float, TAlignedHeapAllocator<16>> Data;
+};
+
+inline FPoseCompareResult FPoseSnapshotSoA::CompareFrame(const FPoseSnapshotSoA& A, int32 FrameA, const FPoseSnapshotSoA& B, int32 FrameB, const FPoseToleranceSettings& Settings)
+{
+    check(A.NumBones == B.NumBones && A.PaddedBones == B.PaddedBones);
+
+    const VectorRegister4Float TranslationTolSq = VectorSetFloat1(FMath::Square(Settings.TranslationTolerance));
+    const VectorRegister4Float CosHalfRotationTol = VectorSetFloat1(FMath::Cos(FMath::DegreesToRadians(Settings.RotationToleranceDegrees) * 0.5f));
+    const VectorRegister4Float ScaleTol = VectorSetFloat1(Settings.ScaleTolerance);
+
+    VectorRegister4Float MaxDistSq = VectorZeroFloat();
+    VectorRegister4Float MinAbsDot = VectorOneFloat();
+    VectorRegister4Float MaxScaleDiff = VectorZeroFloat();
+
+    const float* AStreams[NumStreams];
+    const float* BStreams[NumStreams];
+    for (int32 Stream = 0; Stream < NumStreams; ++Stream)
+    {
+        AStreams[Stream] = A.GetStream(FrameA, static_cast<EStream>(Stream));
+        BStreams[Stream] = B.GetStream(FrameB, static_cast<EStream>(Stream));
+    }
+
+    FPoseCompareResult Result;
+    for (int32 Bone = 0; Bone < A.PaddedBones; Bone += 4)
+    {
+        // 平移：距离平方
+        const VectorRegister4Float DX = VectorSubtract(VectorLoadAligned(AStreams[TranslationX] + Bone), VectorLoadAligned(BStreams[TranslationX] + Bone));
+        const VectorRegister4Float DY = VectorSubtract(VectorLoadAligned(AStreams[TranslationY] + Bone), VectorLoadAligned(BStreams[TranslationY] + Bone));
+        const VectorRegister4Float DZ = VectorSubtract(VectorLoadAligned(AStreams[TranslationZ] + Bone), VectorLoadAligned(BStreams[TranslationZ] + Bone));
+        const VectorRegister4Float DistSq = VectorMultiplyAdd(DZ, DZ, VectorMultiplyAdd(DY, DY, VectorMultiply(DX, DX)));
+
+        // 旋转：|dot|，q与-q表示同一旋转
+        VectorRegister4Float Dot = VectorMultiply(VectorLoadAligned(AStreams[RotationX] + Bone), VectorLoadAligned(BStreams[RotationX] + Bone));
+        Dot = VectorMultiplyAdd(VectorLoadAligned(AStreams[RotationY] + Bone), VectorLoadAligned(BStreams[RotationY] + Bone), Dot);
+        Dot = VectorMultiplyAdd(VectorLoadAligned(AStreams[RotationZ] + Bone), VectorLoadAligned(BStreams[RotationZ] + Bone), Dot);
+        Dot = VectorMultiplyAdd(VectorLoadAligned(AStreams[RotationW] + Bone), VectorLoadAligned(BStreams[RotationW] + Bone), Dot);
+        const VectorRegister4Float AbsDot = VectorAbs(Dot);
+
+        // 缩放：各分量绝对差的最大值
+        const VectorRegister4Float SX = VectorAbs(VectorSubtract(VectorLoadAligned(AStreams[ScaleX] + Bone), VectorLoadAligned(BStreams[ScaleX] + Bone)));
+        const VectorRegister4Float SY = VectorAbs(VectorSubtract(VectorLoadAligned(AStreams[ScaleY] + Bone), VectorLoadAligned(BStreams[ScaleY] + Bone)));
+        const VectorRegister4Float SZ = VectorAbs(VectorSubtract(VectorLoadAligned(AStreams[ScaleZ] + Bone), VectorLoadAligned(BStreams[ScaleZ] + Bone)));
+        const VectorRegister4Float ScaleDiff = VectorMax(SX, VectorMax(SY, SZ));
+
+        MaxDistSq = VectorMax(MaxDistSq, DistSq);
+        MinAbsDot = VectorMin(MinAbsDot, AbsDot);
+        MaxScaleDiff = VectorMax(MaxScaleDiff, ScaleDiff);
+
+        const VectorRegister4Float Mismatch = VectorBitwiseOr(
+            VectorBitwiseOr(VectorCompareGT(DistSq, TranslationTolSq), VectorCompareLT(AbsDot, CosHalfRotationTol)),
+            VectorCompareGT(ScaleDiff, ScaleTol));
+
+        const uint32 MismatchBits = static_cast<uint32>(VectorMaskBits(Mismatch));
+        if (MismatchBits != 0)
+        {
+            if (Result.FirstMismatchedBone == INDEX_NONE)
+            {
+                Result.FirstMismatchedBone = Bone + static_cast<int32>(FMath::CountTrailingZeros(MismatchBits));
+            }
+            Result.NumMismatchedBones += static_cast<int32>(FMath::CountBits(MismatchBits));
+        }
+    }
+
+    alignas(16) float MaxDistSqLanes[4];
+    alignas(16) float MinAbsDotLanes[4];
+    alignas(16) float MaxScaleLanes[4];
+    VectorStoreAligned(MaxDistSq, MaxDistSqLanes);
+    VectorStoreAligned(MinAbsDot, MinAbsDotLanes);
+    VectorStoreAligned(MaxScaleDiff, MaxScaleLanes);
+
+    const float WorstDistSq = FMath::Max(FMath::Max(MaxDistSqLanes[0], MaxDistSqLanes[1]), FMath::Max(MaxDistSqLanes[2], MaxDistSqLanes[3]));
+    const float WorstAbsDot = FMath::Min(FMath::Min(MinAbsDotLanes[0], MinAbsDotLanes[1]), FMath::Min(MinAbsDotLanes[2], MinAbsDotLanes[3]));
+    Result.MaxTranslationError = FMath::Sqrt(WorstDistSq);
+    Result.MaxRotationErrorDegrees = FMath::RadiansToDegrees(2.0f * FMath::Acos(FMath::Min(WorstAbsDot, 1.0f)));
+    Result.MaxScaleError = FMath::Max(FMath::Max(MaxScaleLanes[0], MaxScaleLanes[1]), FMath::Max(MaxScaleLanes[2], MaxScaleLanes[3]));
+    return Result;
+}
@@ -0,0 +1,368 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/PlatformTime.h"
+
+/**
+ * 阻止编译器把基准测试中的计算结果当作无用代码优化掉
+ * @param Value 需要保留的值
+ */
+template<typename T>
+FORCEINLINE void DoNotOptimize(const T& Value)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    const volatile char* Sink = reinterpret_cast<const volatile char*>(&Value);
+    (void)*Sink;
+    _ReadWriteBarrier();
+#else
+    asm volatile("" : : "r,m"(Value) : "memory");
+#endif
+}
+
+/**
+ * FTestBenchmarkSettings
+ * 基准测试参数
+ */
+struct FTestBenchmarkSettings
+{
+    /** 预热时长（秒），预热期间不记录样本 */
+    double WarmupSeconds = 0.1;
+
+    /** 校准目标：每个样本至少运行的时长（秒），迭代次数按此自动确定 */
+    double MinSampleSeconds = 0.01;
+
+    /** 样本数量 */
+    int32 NumSamples = 30;
+
+    /** 每个样本的最大迭代次数 */
+    int64 MaxIterationsPerSample = 1 << 24;
+};
+
+/**
+ * FTestBenchmarkStats
+ * 基准测试统计结果，时间均为单次迭代耗时（秒）
+ */
+struct FTestBenchmarkStats
+{
+    FString Name;
+    int32 NumSamples = 0;
+    int64 IterationsPerSample = 0;
+    double MinSeconds = 0.0;
+    double MedianSeconds = 0.0;
+    double MeanSeconds = 0.0;
+    double P95Seconds = 0.0;
+    double P99Seconds = 0.0;
+    double StdDevSeconds = 0.0;
+
+    /**
+     * 根据样本计算统计量
+     * @param InName 基准测试名称
+     * @param SampleSeconds 每个样本的总耗时（秒）
+     * @param InIterationsPerSample 每个样本的迭代次数
+     * @return 统计结果
+     */
+    static FTestBenchmarkStats FromSamples(const FString& InName, TArray<double> SampleSeconds, int64 InIterationsPerSample);
+};
+
+/**
+ * FTestHistogram
+ * 按2的幂划分的耗时直方图（微秒），记录时不分配内存
+ * 第0个桶为小于1微秒，第i个桶为 [2^(i-1), 2^i) 微秒
+ */
+struct FTestHistogram
+{
+    static constexpr int32 NumBuckets = 24;
+
+    uint32 Buckets[NumBuckets] = {};
+    int64 NumSamples = 0;
+
+    /**
+     * 记录一个样本
+     * @param Seconds 耗时（秒）
+     */
+    FORCEINLINE void Add(double Seconds)
+    {
+        const uint64 Microseconds = static_cast<uint64>(FMath::Max(Seconds, 0.0) * 1000000.0);
+        const int32 Bucket = Microseconds == 0 ? 0 : FMath::Min(static_cast<int32>(FMath::FloorLog2_64(Microseconds)) + 1, NumBuckets - 1);
+        ++Buckets[Bucket];
+        ++NumSamples;
+    }
+
+    /**
+     * 估算百分位耗时，返回所在桶的上界
+     * @param Percentile 百分位（0~1）
+     * @return 耗时（秒）
+     */
+    double GetPercentileUpperBound(double Percentile) const;
+
+    /**
+     * 格式化为多行文本，每个非空桶一行
+     * @param Label 标题
+     * @return 直方图文本
+     */
+    FString ToString(const FString& Label) const;
+};
+
+/**
+ * FTestBenchmarkState
+ * BENCHMARK_METHOD中的循环状态
+ * 方法体只执行一次，KeepRunning 依次驱动预热、迭代次数校准和采样三个阶段：
+ *   while (State.KeepRunning()) { ... }
+ */
+class FTestBenchmarkState
+{
+public:
+    /**
+     * 构造函数
+     * @param InName 基准测试名称
+     */
+    explicit FTestBenchmarkState(const FString& InName);
+
+    /**
+     * 修改参数，必须在第一次调用 KeepRunning 之前调用
+     * @param InSettings 基准测试参数
+     */
+    void Configure(const FTestBenchmarkSettings& InSettings);
+
+    /**
+     * 是否继续迭代
+     * 当前批次内只递减计数，批次结束时记录耗时并进入下一阶段
+     * @return 是否继续
+     */
+    FORCEINLINE bool KeepRunning()
+    {
+        if (RemainingIterations > 0)
+        {
+            --RemainingIterations;
+            return true;
+        }
+
+        return AdvanceBatch();
+    }
+
+    /**
+     * 暂停计时，用于排除每次迭代中的准备代码
+     */
+    void PauseTiming();
+
+    /**
+     * 恢复计时
+     */
+    void ResumeTiming();
+
+    /**
+     * 获取统计结果，KeepRunning 返回false后有效
+     * @return 统计结果
+     */
+    const FTestBenchmarkStats& GetStats() const;
+
+private:
+    /**
+     * 结束当前批次：记录耗时，切换预热/校准/采样阶段，并设置下一批次的迭代次数
+     * @return 是否还有下一批次
+     */
+    bool AdvanceBatch();
+
+    enum class EPhase : uint8
+    {
+        NotStarted,
+        Warmup,
+        Calibrate,
+        Sample,
+        Finished
+    };
+
+    FString Name;
+    FTestBenchmarkSettings Settings;
+    EPhase Phase;
+    int64 RemainingIterations;
+    int64 BatchIterations;
+    uint64 BatchStartCycles;
+    uint64 PausedCycles;
+    uint64 PauseStartCycles;
+    TArray<double> SampleSeconds;
+    FTestBenchmarkStats Stats;
+};
+
+/**
+ * FTestBenchmarkReporter
+ * 汇总基准测试结果并输出为JSON/CSV
+ * 默认输出到 Saved/Automation/Benchmarks，可通过命令行 -BenchmarkOutput=<Dir> 修改
+ */
+class FTestBenchmarkReporter
+{
+public:
+    /**
+     * 记录结果：写入测试日志，并追加到本次运行的结果集合
+     * @param TestRunner 测试实例
+     * @param Stats 统计结果
+     */
+    static void Report(FAutomationTestBase& TestRunner, const FTestBenchmarkStats& Stats);
+
+    /**
+     * 将本次运行的全部结果写为JSON
+     * @param FilePath 输出文件路径
+     * @return 是否成功
+     */
+    static bool WriteJson(const FString& FilePath);
+
+    /**
+     * 将本次运行的全部结果写为CSV（每个基准测试一行）
+     * @param FilePath 输出文件路径
+     * @return 是否成功
+     */
+    static bool WriteCsv(const FString& FilePath);
+
+    /**
+     * 获取输出目录
+     * @return 输出目录
+     */
+    static FString GetOutputDirectory();
+
+    /**
+     * 获取本次运行的全部结果
+     * @return 结果数组
+     */
+    static const TArray<FTestBenchmarkStats>& GetResults();
+};
+
+/**
+ * FPerfBaselineEntry
+ * 单个性能指标的基线
+ */
+struct FPerfBaselineEntry
+{
+    /** 基线值（越小越好，如耗时、字节数） */
+    double Value = 0.0;
+
+    /** 记录基线时测得的标准差，单值指标为0 */
+    double StdDev = 0.0;
+};
+
+/**
+ * FPerfBaselineSettings
+ * 基线比较的容差
+ * 判定阈值 = Value * (1 + RelativeTolerance) + NoiseSigmas * StdDev
+ */
+struct FPerfBaselineSettings
+{
+    /** 允许的相对退化比例，默认15% */
+    double RelativeTolerance = 0.15;
+
+    /** 在相对容差之外额外允许的噪声，以基线标准差的倍数表示 */
+    double NoiseSigmas = 2.0;
+};
+
+/**
+ * FPerfBaselineStore
+ * 按机器类型存储的性能基线，用于检测相对退化而不是只检查绝对阈值
+ *
+ * 基线文件为 <ProjectDir>/Tests/PerfBaselines/<MachineClass>.json，随仓库提交；
+ * 机器类型取命令行 -PerfMachineClass=<Name>，未指定时为 "平台名-逻辑核数c"（如 Linux-32c）；
+ * 命令行带 -UpdatePerfBaselines 时不做比较，改为记录当前值并在引擎退出前写回基线文件
+ */
+class FPerfBaselineStore
+{
+public:
+    /**
+     * 获取全局实例，首次调用时加载当前机器类型的基线文件
+     * @return 基线存储
+     */
+    static FPerfBaselineStore& Get();
+
+    /**
+     * 检查单值指标
+     * 超过阈值时报告错误；没有基线时报告警告并通过
+     * @param TestRunner 测试实例
+     * @param MetricName 指标名称，建议使用 "测试类.指标" 格式
+     * @param Value 本次测得的值
+     * @return 是否通过
+     */
+    bool Check(FAutomationTestBase& TestRunner, const FString& MetricName, double Value);
+
+    /**
+     * 检查基准测试结果，以中位数比较，更新模式下同时记录标准差
+     * @param TestRunner 测试实例
+     * @param MetricName 指标名称
+     * @param Stats 基准测试统计结果
+     * @return 是否通过
+     */
+    bool Check(FAutomationTestBase& TestRunner, const FString& MetricName, const FTestBenchmarkStats& Stats);
+
+    /**
+     * 设置默认容差
+     * @param InSettings 容差
+     */
+    void SetSettings(const FPerfBaselineSettings& InSettings);
+
+    /**
+     * 为单个指标设置容差，覆盖默认容差
+     * @param MetricName 指标名称
+     * @param InSettings 容差
+     */
+    void SetMetricSettings(const FString& MetricName, const FPerfBaselineSettings& InSettings);
+
+    /**
+     * 是否处于基线更新模式
+     * @return 是否更新模式
+     */
+    bool IsUpdateMode() const;
+
+    /**
+     * 获取当前机器类型
+     * @return 机器类型
+     */
+    const FString& GetMachineClass() const;
+
+    /**
+     * 获取当前机器类型的基线文件路径
+     * @return 文件路径
+     */
+    FString GetBaselineFilePath() const;
+
+    /**
+     * 写回基线文件（按指标名称排序，便于代码评审）
+     * @return 是否成功
+     */
+    bool Save() const;
+
+private:
+    FPerfBaselineStore();
+
+    bool Load();
+    bool CheckInternal(FAutomationTestBase& TestRunner, const FString& MetricName, double Value, double StdDev);
+
+    TMap<FString, FPerfBaselineEntry> Baselines;
+    TMap<FString, FPerfBaselineSettings> MetricSettings;
+    FPerfBaselineSettings DefaultSettings;
+    FString MachineClass;
+    bool bUpdateMode;
+};
+
+/**
+ * ASSERT_PERF
+ * 与基线比较的性能断言，退化超过容差时测试失败并提前返回
+ * 错误由 FPerfBaselineStore::Check 报告，每次退化只报告一次
+ * Value 可以是单值（double）或 FTestBenchmarkStats
+ */
+#define ASSERT_PERF(MetricName, Value) \
+    if (!FPerfBaselineStore::Get().Check(TestRunner, MetricName, Value)) { return; }
+
+/**
+ * BENCHMARK_METHOD
+ * 在TEST_CLASS中定义微基准测试，与TEST_METHOD共用BEFORE_EACH/AFTER_EACH和数据成员
+ * 方法体中通过 State 驱动迭代：
+ *   BENCHMARK_METHOD(Name)
+ *   {
+ *       while (State.KeepRunning()) { DoNotOptimize(Compute()); }
+ *   }
+ */
+#define BENCHMARK_METHOD(MethodName) \
+    TEST_METHOD(MethodName) \
+    { \
+        FTestBenchmarkState State(TEXT(#MethodName)); \
+        MethodName##_Benchmark(State); \
+        FTestBenchmarkReporter::Report(TestRunner, State.GetStats()); \
+    } \
+    void MethodName##_Benchmark(FTestBenchmarkState& State)
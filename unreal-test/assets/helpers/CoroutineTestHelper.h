@@ -0,0 +1,367 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Engine/World.h"
+#include "Helpers/LatentCommandArena.h"
+#include "Helpers/LatentCommandHelper.h"
+
+#include <coroutine>
+
+// 需要C++20：在测试模块的Build.cs中设置 CppStandard = CppStandardVersion.Cpp20（UE5.3起为默认值）
+
+class FLatentTestScheduler;
+
+/**
+ * FLatentTestTask
+ * TEST_COROUTINE 方法体的协程返回类型
+ * 协程帧从调度器持有的竞技场分配，由调度器启动、恢复和销毁
+ */
+class FLatentTestTask
+{
+public:
+    struct promise_type
+    {
+        /** 驱动该协程的调度器，启动时设置 */
+        FLatentTestScheduler* Scheduler = nullptr;
+
+        FLatentTestTask get_return_object()
+        {
+            return FLatentTestTask(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        /** 创建后挂起，由调度器在第一个Latent Update中启动 */
+        std::suspend_always initial_suspend() noexcept
+        {
+            return {};
+        }
+
+        /** 结束后挂起，协程帧由调度器销毁 */
+        std::suspend_always final_suspend() noexcept
+        {
+            return {};
+        }
+
+        void return_void()
+        {
+        }
+
+        void unhandled_exception()
+        {
+            checkNoEntry();
+        }
+
+        /**
+         * 从当前线程正在启动或恢复协程的调度器的竞技场分配协程帧
+         */
+        static void* operator new(size_t Size);
+
+        static void operator delete(void* Ptr)
+        {
+            FLatentCommandArena::Release(Ptr);
+        }
+    };
+
+    using FHandle = std::coroutine_handle<promise_type>;
+
+    FLatentTestTask(FLatentTestTask&& Other)
+        : Handle(Other.Handle)
+    {
+        Other.Handle = nullptr;
+    }
+
+    FLatentTestTask(const FLatentTestTask&) = delete;
+    FLatentTestTask& operator=(const FLatentTestTask&) = delete;
+
+    /**
+     * 转移协程句柄的所有权
+     * @return 协程句柄
+     */
+    FHandle Release()
+    {
+        FHandle Result = Handle;
+        Handle = nullptr;
+        return Result;
+    }
+
+private:
+    explicit FLatentTestTask(FHandle InHandle)
+        : Handle(InHandle)
+    {
+    }
+
+    FHandle Handle;
+};
+
+/**
+ * FLatentTestAwaiter
+ * 调度器等待的条件
+ * 调度器在目标世界每次Actor Tick之后检查 IsReady，成立时恢复协程，超时则报告错误并中止协程
+ */
+class FLatentTestAwaiter
+{
+public:
+    virtual ~FLatentTestAwaiter() = default;
+
+    /**
+     * 条件是否成立，挂起时调用一次，之后每个世界Tick调用一次
+     * @return 是否成立
+     */
+    virtual bool IsReady() = 0;
+
+    /**
+     * 获取超时时间
+     * @return 超时时间（秒），0表示不超时
+     */
+    float GetTimeout() const
+    {
+        return Timeout;
+    }
+
+    bool await_ready()
+    {
+        return IsReady();
+    }
+
+    void await_suspend(FLatentTestTask::FHandle Handle);
+
+    void await_resume()
+    {
+    }
+
+protected:
+    explicit FLatentTestAwaiter(float InTimeout)
+        : Timeout(InTimeout)
+    {
+    }
+
+private:
+    float Timeout;
+};
+
+/**
+ * FNextFrameAwaiter
+ * 等待目标世界Tick指定帧数
+ */
+class FNextFrameAwaiter : public FLatentTestAwaiter
+{
+public:
+    explicit FNextFrameAwaiter(int32 InNumFrames)
+        : FLatentTestAwaiter(0.0f)
+        , RemainingFrames(InNumFrames)
+    {
+    }
+
+    virtual bool IsReady() override
+    {
+        return RemainingFrames-- <= 0;
+    }
+
+private:
+    int32 RemainingFrames;
+};
+
+/**
+ * TWaitUntilAwaiter
+ * 等待条件成立，条件存放在协程帧中，不经过TFunction的堆分配
+ */
+template<typename TPredicate>
+class TWaitUntilAwaiter : public FLatentTestAwaiter
+{
+public:
+    TWaitUntilAwaiter(TPredicate&& InPredicate, float InTimeout)
+        : FLatentTestAwaiter(InTimeout)
+        , Predicate(MoveTemp(InPredicate))
+    {
+    }
+
+    virtual bool IsReady() override
+    {
+        return Predicate();
+    }
+
+private:
+    TPredicate Predicate;
+};
+
+/**
+ * TDelegateAwaiter
+ * 等待多播委托触发，创建时订阅，协程帧销毁时取消订阅
+ * 委托触发后在下一次世界Tick时恢复，不在广播过程中恢复协程
+ */
+template<typename DelegateType>
+class TDelegateAwaiter : public FLatentTestAwaiter
+{
+public:
+    TDelegateAwaiter(DelegateType& InDelegate, float InTimeout)
+        : FLatentTestAwaiter(InTimeout)
+        , Waiter(InDelegate)
+    {
+    }
+
+    virtual bool IsReady() override
+    {
+        return Waiter.HasFired();
+    }
+
+private:
+    TDelegateWaiter<DelegateType> Waiter;
+};
+
+/**
+ * FLatentTestScheduler
+ * 以世界Tick驱动一个测试协程
+ * 订阅 FWorldDelegates::OnWorldPostActorTick，只处理目标世界，
+ * 协程挂起期间不经过Latent命令队列；协程结束或中止后 IsDone 返回true
+ */
+class FLatentTestScheduler
+{
+public:
+    /**
+     * 构造函数
+     * @param InTestRunner 用于报告超时错误的测试实例
+     * @param InWorld 驱动协程的世界
+     */
+    FLatentTestScheduler(FAutomationTestBase& InTestRunner, UWorld* InWorld);
+    ~FLatentTestScheduler();
+
+    FLatentTestScheduler(const FLatentTestScheduler&) = delete;
+    FLatentTestScheduler& operator=(const FLatentTestScheduler&) = delete;
+
+    /**
+     * 创建协程并运行到第一个co_await
+     * @param Body 返回协程的函数，在调用期间协程帧从本调度器的竞技场分配
+     */
+    void Start(TFunctionRef<FLatentTestTask()> Body);
+
+    /**
+     * 协程挂起时由等待对象调用
+     * @param Awaiter 等待对象，位于协程帧中
+     */
+    void Suspend(FLatentTestAwaiter* Awaiter);
+
+    /**
+     * 协程是否已结束或中止
+     * @return 是否结束
+     */
+    bool IsDone() const;
+
+    /**
+     * 由完成命令每帧调用：引擎没有Tick目标世界时（如ActorTestSpawner创建的世界），以固定步长Tick一次
+     * @param FixedDeltaSeconds 步长（秒）
+     */
+    void TickWorldIfIdle(float FixedDeltaSeconds);
+
+    /**
+     * 获取当前线程正在启动或恢复协程的调度器的竞技场
+     * @return 竞技场，不在调度器中时为nullptr
+     */
+    static FLatentCommandArena* GetCurrentArena();
+
+private:
+    void OnWorldPostActorTick(UWorld* TickedWorld, ELevelTick TickType, float DeltaSeconds);
+    void Resume();
+    void Abort(const FString& Reason);
+
+    FAutomationTestBase& TestRunner;
+    TWeakObjectPtr<UWorld> World;
+    FLatentCommandArena Arena;
+    FLatentTestTask::FHandle Handle;
+    FLatentTestAwaiter* CurrentAwaiter;
+    double SuspendTime;
+    FDelegateHandle TickHandle;
+    bool bTickedSinceLastUpdate;
+    bool bDone;
+};
+
+/**
+ * FLatentTestCoroutineCommand
+ * 协程测试在Latent命令队列中的唯一命令，持有调度器，协程结束时完成
+ */
+class FLatentTestCoroutineCommand : public IAutomationLatentCommand
+{
+public:
+    /**
+     * 构造函数
+     * @param InTestRunner 测试实例
+     * @param InWorld 驱动协程的世界
+     * @param InBody 返回协程的函数，第一次Update时调用
+     */
+    FLatentTestCoroutineCommand(FAutomationTestBase& InTestRunner, UWorld* InWorld, TFunction<FLatentTestTask()> InBody);
+
+    virtual bool Update() override;
+
+private:
+    TUniquePtr<FLatentTestScheduler> Scheduler;
+    TFunction<FLatentTestTask()> Body;
+};
+
+/**
+ * 等待下一帧
+ * @param NumFrames 帧数
+ */
+inline FNextFrameAwaiter NextFrame(int32 NumFrames = 1)
+{
+    return FNextFrameAwaiter(NumFrames);
+}
+
+/**
+ * 等待条件成立
+ * @param Predicate 条件
+ * @param Timeout 超时时间（秒）
+ */
+template<typename TPredicate>
+TWaitUntilAwaiter<std::decay_t<TPredicate>> WaitUntil(TPredicate&& Predicate, float Timeout = 5.0f)
+{
+    return TWaitUntilAwaiter<std::decay_t<TPredicate>>(std::decay_t<TPredicate>(Forward<TPredicate>(Predicate)), Timeout);
+}
+
+/**
+ * 等待多播委托触发
+ * @param Delegate 原生多播委托
+ * @param Timeout 超时时间（秒）
+ */
+template<typename DelegateType>
+TDelegateAwaiter<DelegateType> WaitForDelegate(DelegateType& Delegate, float Timeout = 5.0f)
+{
+    return TDelegateAwaiter<DelegateType>(Delegate, Timeout);
+}
+
+/**
+ * 直接co_await原生多播委托，超时5秒
+ */
+template<typename... ParamTypes, typename UserPolicy>
+TDelegateAwaiter<TMulticastDelegate<void(ParamTypes...), UserPolicy>> operator co_await(TMulticastDelegate<void(ParamTypes...), UserPolicy>& Delegate)
+{
+    return TDelegateAwaiter<TMulticastDelegate<void(ParamTypes...), UserPolicy>>(Delegate, 5.0f);
+}
+
+inline void FLatentTestAwaiter::await_suspend(FLatentTestTask::FHandle Handle)
+{
+    Handle.promise().Scheduler->Suspend(this);
+}
+
+/**
+ * 协程中的断言，失败时结束协程
+ * 协程中不能使用 return，ASSERT_THAT 需替换为 CO_ASSERT_THAT
+ */
+#define CO_ASSERT_THAT(Assertion) if (!(Assert.Assertion)) { co_return; }
+
+/**
+ * TEST_COROUTINE
+ * 协程版本的TEST_METHOD，多帧逻辑按顺序书写：
+ *   TEST_COROUTINE(Name, GetWorld())
+ *   {
+ *       co_await WaitUntil([&]() { return Ready(); });
+ *       co_await NextFrame();
+ *       co_await Actor->OnSomething;
+ *   }
+ * WorldExpr 在测试方法开始时求值，协程在该世界的Tick中恢复
+ * 局部变量位于协程帧中，在整个测试期间有效
+ */
+#define TEST_COROUTINE(MethodName, WorldExpr) \
+    TEST_METHOD(MethodName) \
+    { \
+        TestRunner.AddCommand(new FLatentTestCoroutineCommand(TestRunner, WorldExpr, [this]() { return MethodName##_Coroutine(); })); \
+    } \
+    FLatentTestTask MethodName##_Coroutine()
@@ -4,11 +4,18 @@
 #include "GameFramework/Pawn.h"
 #include "InputActionValue.h"
 #include "EnhancedInputComponent.h"
+#include "InputAction.h"
+#include "InputTriggers.h"
 #include "Input/Keys.h"
+#include "Algo/StableSort.h"
 
 // 前向声明
 class APawn;
 class UEnhancedInputComponent;
+class UInputAction;
+class ActorTestSpawner;
+class FInputEventBatch;
+class FMultiWorldTestRunner;
 struct FInputActionValue;
 
 /**
@@ -57,6 +64,16 @@ public:
      */
     void TriggerAction(const FName& ActionName, float AxisValue);
 
+    /**
+     * 以指定触发事件调用输入动作的绑定（录制回放使用）
+     * 只调用输入组件中该动作绑定到 TriggerEvent 的回调，Started/Ongoing/Completed/Canceled 的绑定不会被 TriggerAction 调用
+     * @param ActionName 动作名称
+     * @param TriggerEvent 触发事件
+     * @param Value 输入值
+     * @return 是否找到该动作的绑定
+     */
+    bool TriggerActionEvent(const FName& ActionName, ETriggerEvent TriggerEvent, const FInputActionValue& Value);
+
     /**
      * 模拟按键按下
      * @param Key 要按下的键
@@ -125,6 +142,16 @@ public:
      */
     void ResetAxis(const FName& AxisName);
 
+    /**
+     * 一次性注入批次中的全部事件
+     * 按帧内时间戳依次调用输入组件中对应动作的 Triggered 绑定，时间戳相同的事件保持添加顺序；
+     * 批次已有序时直接遍历，否则稳定排序Helper持有的事件序号数组（逐帧复用），不修改批次本身；
+     * 动作名到绑定的查找按批次的动作名表只做一次，之后每个事件只是一次回调
+     * @param Batch 事件批次，注入后保持不变，可调用 Reset 复用
+     * @return 注入的事件数，输入组件中没有绑定的动作被跳过
+     */
+    int32 InjectBatch(const FInputEventBatch& Batch);
+
     /**
      * 获取输入组件
      * @return 输入组件指针
@@ -148,6 +175,9 @@ private:
     UEnhancedInputComponent* InputComponent;
     bool bInitialized;
 
+    /** InjectBatch 对乱序批次排序用的事件序号，保留容量逐帧复用 */
+    TArray<int32> BatchOrder;
+
     /**
      * 内部初始化
      */
@@ -164,3 +194,478 @@ private:
      */
     bool ValidateInputComponent() const;
 };
+
+/**
+ * FInputRecording
+ * 按帧记录的Enhanced Input事件流，紧凑二进制格式：
+ *   文件头：魔数 "IREC"、版本、固定步长、总帧数、动作名表
+ *   每个事件：帧序号增量（varint）、动作名表序号（varint）、触发事件（1字节，ETriggerEvent）、值类型（1字节）、值
+ * 值类型为 Bool 时值编码在类型字节中（BoolFalse/BoolTrue），Axis1D/2D/3D 依次写1/2/3个float，
+ * 同一帧内的事件帧序号增量为0，只占1字节；版本2加入触发事件字节，版本1的文件无法读取
+ */
+class FInputRecording
+{
+public:
+    /** 值类型字节 */
+    enum class EValueTag : uint8
+    {
+        BoolFalse,
+        BoolTrue,
+        Axis1D,
+        Axis2D,
+        Axis3D
+    };
+
+    /**
+     * 清空记录
+     * @param InFixedDeltaSeconds 录制和回放使用的固定步长（秒）
+     */
+    void Reset(float InFixedDeltaSeconds = 1.0f / 60.0f);
+
+    /**
+     * 查找或添加动作名
+     * @param ActionName 动作名称
+     * @return 动作名表序号
+     */
+    int32 FindOrAddAction(FName ActionName);
+
+    /**
+     * 追加一个事件，帧序号必须单调不减
+     * @param Frame 帧序号（从录制开始计）
+     * @param ActionIndex 动作名表序号
+     * @param TriggerEvent 触发事件
+     * @param Value 输入值
+     */
+    void Append(uint32 Frame, int32 ActionIndex, ETriggerEvent TriggerEvent, const FInputActionValue& Value);
+
+    /**
+     * 标记录制结束的帧，之后没有输入的帧也会被回放
+     * @param Frame 最后一帧的帧序号
+     */
+    void SetEndFrame(uint32 Frame);
+
+    int32 GetNumEvents() const
+    {
+        return NumEvents;
+    }
+
+    uint32 GetNumFrames() const
+    {
+        return NumFrames;
+    }
+
+    float GetFixedDeltaSeconds() const
+    {
+        return FixedDeltaSeconds;
+    }
+
+    const TArray<FName>& GetActionNames() const
+    {
+        return ActionNames;
+    }
+
+    /**
+     * 获取事件流的字节数（不含文件头）
+     * @return 字节数
+     */
+    int32 GetStreamSize() const
+    {
+        return Stream.Num();
+    }
+
+    /**
+     * 写入文件
+     * @param FilePath 文件路径
+     * @return 是否成功
+     */
+    bool SaveToFile(const FString& FilePath) const;
+
+    /**
+     * 从文件读取
+     * @param FilePath 文件路径
+     * @return 是否成功（魔数、版本和事件流均有效）
+     */
+    bool LoadFromFile(const FString& FilePath);
+
+    /**
+     * FReader
+     * 顺序解码事件流，不分配内存
+     */
+    class FReader
+    {
+    public:
+        explicit FReader(const FInputRecording& InRecording);
+
+        /**
+         * 查看下一个事件的帧序号
+         * @param OutFrame 帧序号
+         * @return 是否还有事件
+         */
+        bool PeekFrame(uint32& OutFrame) const;
+
+        /**
+         * 读取下一个事件
+         * @param OutFrame 帧序号
+         * @param OutActionIndex 动作名表序号
+         * @param OutTriggerEvent 触发事件
+         * @param OutValue 输入值
+         * @return 是否读取成功
+         */
+        bool Next(uint32& OutFrame, int32& OutActionIndex, ETriggerEvent& OutTriggerEvent, FInputActionValue& OutValue);
+
+    private:
+        const FInputRecording& Recording;
+        int32 Offset;
+        uint32 CurrentFrame;
+    };
+
+private:
+    TArray<FName> ActionNames;
+    TArray<uint8> Stream;
+    uint32 LastFrame = 0;
+    uint32 NumFrames = 0;
+    int32 NumEvents = 0;
+    float FixedDeltaSeconds = 1.0f / 60.0f;
+};
+
+/**
+ * FInputRecorder
+ * 录制Pawn的Enhanced Input事件流
+ * 为输入组件中已绑定的每个 UInputAction 额外绑定 Started/Ongoing/Triggered/Completed/Canceled 回调，
+ * 按录制器自身的步数写入 FInputRecording，不依赖 GFrameCounter；
+ * 录制不影响原有绑定。可在PIE中通过控制台命令录制真实游玩，生成回归测试用的录制文件
+ */
+class FInputRecorder
+{
+public:
+    /**
+     * 构造函数
+     * @param InHelper 提供Pawn和输入组件的Helper
+     * @param InFixedDeltaSeconds 回放时使用的固定步长（秒）
+     */
+    explicit FInputRecorder(InputTestHelper& InHelper, float InFixedDeltaSeconds = 1.0f / 60.0f);
+    ~FInputRecorder();
+
+    /**
+     * 开始录制，帧序号从0开始
+     * @param bAdvanceOnWorldTick 为true时订阅Pawn所在世界的Tick，每次Tick后自动调用 AdvanceFrame（控制台命令录制使用）；
+     *        测试中手动推进世界时传false，每帧推进后调用 AdvanceFrame
+     */
+    void Start(bool bAdvanceOnWorldTick = false);
+
+    /**
+     * 推进录制帧，之后的事件记录到下一帧
+     * 与回放时每帧的 AdvanceWorld 对应，在每次推进世界一帧后调用
+     */
+    void AdvanceFrame();
+
+    /**
+     * 获取当前录制帧
+     * @return 从 Start 起推进的帧数
+     */
+    uint32 GetCurrentFrame() const;
+
+    /**
+     * 停止录制
+     */
+    void Stop();
+
+    bool IsRecording() const;
+
+    const FInputRecording& GetRecording() const;
+
+    /**
+     * 注册控制台命令
+     * - Input.StartRecording：为本地玩家的Pawn开始录制
+     * - Input.StopRecording <FilePath>：停止录制并写入文件
+     */
+    static void RegisterConsoleCommands();
+
+private:
+    void HandleAction(const FInputActionInstance& Instance);
+
+    void OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+
+    InputTestHelper& Helper;
+    FInputRecording Recording;
+    TMap<const UInputAction*, int32> ActionIndices;
+    TArray<uint32> BindingHandles;
+    FDelegateHandle WorldTickHandle;
+    uint32 CurrentFrame;
+    bool bRecording;
+};
+
+/**
+ * FInputReplayer
+ * 在固定步长下回放 FInputRecording
+ * 每帧先通过 InputTestHelper::TriggerActionEvent 按录制的触发事件注入该帧的全部事件，再以录制时的固定步长推进世界一帧，
+ * 速度只受机器Tick速度限制，10分钟的录制通常在数秒内回放完毕
+ */
+class FInputReplayer
+{
+public:
+    /**
+     * 构造函数
+     * @param InHelper 注入输入的Helper
+     * @param InRecording 录制，必须比Replayer存活更久
+     */
+    FInputReplayer(InputTestHelper& InHelper, const FInputRecording& InRecording);
+
+    /**
+     * 回放指定帧数
+     * @param Spawner 提供测试世界的Spawner，通过 AdvanceWorld 推进
+     * @param MaxFrames 最多回放的帧数
+     * @return 实际回放的帧数
+     */
+    int32 ReplayFrames(ActorTestSpawner& Spawner, int32 MaxFrames);
+
+    /**
+     * 回放全部帧
+     * @param Spawner 提供测试世界的Spawner
+     * @param PerFrameCheck 每帧推进后调用，返回false时停止回放，可用于逐帧不变量检查
+     * @return 是否回放到最后一帧
+     */
+    bool ReplayAll(ActorTestSpawner& Spawner, TFunctionRef<bool(uint32 Frame)> PerFrameCheck = [](uint32) { return true; });
+
+    bool IsFinished() const;
+
+    uint32 GetCurrentFrame() const;
+
+    /**
+     * 获取录制中存在但当前输入组件没有绑定的动作名，这些动作的事件会被跳过
+     * @return 动作名
+     */
+    TArray<FName> GetUnboundActions() const;
+
+private:
+    InputTestHelper& Helper;
+    const FInputRecording& Recording;
+    FInputRecording::FReader Reader;
+    uint32 CurrentFrame;
+};
+
+/**
+ * FInputBatchEvent
+ * 批次中的单个输入事件
+ */
+struct FInputBatchEvent
+{
+    /** 批次动作名表序号 */
+    int32 ActionIndex = INDEX_NONE;
+
+    /** 帧内时间戳（0~1，帧起点到终点的比例） */
+    float TimeInFrame = 0.0f;
+
+    /** 输入值 */
+    FInputActionValue Value;
+};
+
+/**
+ * FInputEventBatch
+ * 一帧内的输入事件队列，通过 InputTestHelper::InjectBatch 一次性注入
+ * Reset 只清空事件，保留容量和动作名表，逐帧复用时不分配内存
+ */
+class FInputEventBatch
+{
+public:
+    /**
+     * 构造函数
+     * @param InitialCapacity 预分配的事件数
+     */
+    explicit FInputEventBatch(int32 InitialCapacity = 256)
+    {
+        Events.Reserve(InitialCapacity);
+    }
+
+    /**
+     * 查找或添加动作名，热循环中先解析序号再用序号添加事件
+     * @param ActionName 动作名称
+     * @return 动作名表序号
+     */
+    int32 FindOrAddAction(FName ActionName)
+    {
+        return ActionNames.AddUnique(ActionName);
+    }
+
+    /**
+     * 添加事件
+     * @param ActionIndex 动作名表序号
+     * @param Value 输入值
+     * @param TimeInFrame 帧内时间戳（0~1）
+     */
+    FORCEINLINE void Add(int32 ActionIndex, const FInputActionValue& Value, float TimeInFrame = 0.0f)
+    {
+        bSorted &= Events.Num() == 0 || Events.Last().TimeInFrame <= TimeInFrame;
+        FInputBatchEvent& Event = Events.AddDefaulted_GetRef();
+        Event.ActionIndex = ActionIndex;
+        Event.TimeInFrame = TimeInFrame;
+        Event.Value = Value;
+    }
+
+    /**
+     * 按动作名添加事件
+     * @param ActionName 动作名称
+     * @param Value 输入值
+     * @param TimeInFrame 帧内时间戳（0~1）
+     */
+    void Add(FName ActionName, const FInputActionValue& Value, float TimeInFrame = 0.0f)
+    {
+        Add(FindOrAddAction(ActionName), Value, TimeInFrame);
+    }
+
+    /**
+     * 按帧内时间戳稳定排序，已有序时不做任何事
+     */
+    void SortByTime()
+    {
+        if (!bSorted)
+        {
+            Algo::StableSortBy(Events, &FInputBatchEvent::TimeInFrame);
+            bSorted = true;
+        }
+    }
+
+    /**
+     * 清空事件，保留容量和动作名表
+     */
+    void Reset()
+    {
+        Events.Reset();
+        bSorted = true;
+    }
+
+    int32 Num() const
+    {
+        return Events.Num();
+    }
+
+    /**
+     * 事件是否已按帧内时间戳有序
+     * @return 是否有序
+     */
+    bool IsSortedByTime() const
+    {
+        return bSorted;
+    }
+
+    const TArray<FName>& GetActionNames() const
+    {
+        return ActionNames;
+    }
+
+    TArrayView<const FInputBatchEvent> GetEvents() const
+    {
+        return Events;
+    }
+
+private:
+    TArray<FName> ActionNames;
+    TArray<FInputBatchEvent> Events;
+    bool bSorted = true;
+};
+
+/**
+ * FInputFuzzerSettings
+ * 随机输入参数
+ */
+struct FInputFuzzerSettings
+{
+    /** 随机种子，第i个世界使用 Seed + i，失败时据此复现 */
+    int32 Seed = 12345;
+
+    /** 每个世界运行的帧数 */
+    int32 NumFrames = 600;
+
+    /** 每帧事件数范围 */
+    int32 MinEventsPerFrame = 1;
+    int32 MaxEventsPerFrame = 32;
+
+    /** 参与随机的动作名，为空时使用输入组件中绑定的全部动作 */
+    TArray<FName> Actions;
+
+    /** 轴值范围 [-AxisRange, AxisRange] */
+    float AxisRange = 1.0f;
+};
+
+/**
+ * FInputFuzzFailure
+ * 不变量失败记录
+ */
+struct FInputFuzzFailure
+{
+    /** 世界序号 */
+    int32 WorldIndex = INDEX_NONE;
+
+    /** 该世界使用的种子 */
+    int32 Seed = 0;
+
+    /** 失败的帧序号 */
+    int32 Frame = 0;
+
+    /** 不变量检查返回的描述 */
+    FString Description;
+};
+
+/**
+ * FInputFuzzer
+ * 以种子确定的随机输入驱动多个测试世界
+ * 每个世界由 FMultiWorldTestRunner 的一个上下文承载；每帧生成一个 FInputEventBatch
+ * （随机动作、按动作值类型生成的随机值、随机帧内时间戳）并通过 InjectBatch 注入，
+ * 推进一帧后检查不变量，失败时记录种子和帧序号并结束该世界
+ */
+class FInputFuzzer
+{
+public:
+    /**
+     * 检查不变量
+     * @param Pawn 被测Pawn
+     * @param OutDescription 失败时的描述
+     * @return 不变量是否成立
+     */
+    using FInvariantCheck = TFunction<bool(APawn* Pawn, FString& OutDescription)>;
+
+    explicit FInputFuzzer(const FInputFuzzerSettings& InSettings);
+
+    /**
+     * 向Runner添加世界
+     * Runner 需以每个时间片1帧构造（默认值），保证每帧注入一次批次
+     * @param Runner 多世界Runner
+     * @param NumWorlds 世界数量
+     * @param SpawnPawn 在新世界中生成被测Pawn
+     * @param Invariant 每帧推进后检查的不变量
+     */
+    void AddWorlds(FMultiWorldTestRunner& Runner, int32 NumWorlds, TFunction<APawn*(ActorTestSpawner&)> SpawnPawn, FInvariantCheck Invariant);
+
+    /**
+     * 生成一帧的随机事件
+     * @param Random 随机流
+     * @param ActionIndices 可选动作的批次序号
+     * @param ValueTypes 各动作的值类型，与 ActionIndices 一一对应
+     * @param OutBatch 输出批次，追加事件
+     */
+    void FillFrame(FRandomStream& Random, TArrayView<const int32> ActionIndices, TArrayView<const EInputActionValueType> ValueTypes, FInputEventBatch& OutBatch) const;
+
+    /**
+     * 获取全部失败记录，按世界序号排序
+     * @return 失败记录
+     */
+    const TArray<FInputFuzzFailure>& GetFailures() const;
+
+    /**
+     * 获取注入的事件总数
+     * @return 事件数
+     */
+    int64 GetTotalInjectedEvents() const;
+
+    /**
+     * 输出事件总数、每秒事件数和失败记录到测试日志，有失败时报告错误
+     * @param TestRunner 测试实例
+     * @param WallSeconds 运行耗时（秒），通常取 FMultiWorldRunReport::WallSeconds
+     */
+    void Report(FAutomationTestBase& TestRunner, double WallSeconds) const;
+
+private:
+    FInputFuzzerSettings Settings;
+    TArray<FInputFuzzFailure> Failures;
+    int64 TotalInjectedEvents;
+};
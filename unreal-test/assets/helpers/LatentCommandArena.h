@@ -0,0 +1,489 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/PlatformTime.h"
+
+/**
+ * FLatentCommandArenaState
+ * 竞技场的内存块与引用计数
+ * 测试对象（竞技场所有者）和自动化框架中的命令谁后销毁由框架决定，
+ * 因此内存块在所有者释放且所有分配都已归还后才一次性释放
+ */
+struct FLatentCommandArenaState
+{
+    /** 已分配的内存块 */
+    TArray<uint8*, TInlineAllocator<8>> Blocks;
+
+    /** 当前块中的分配位置 */
+    uint8* Cursor = nullptr;
+
+    /** 当前块的末尾 */
+    uint8* End = nullptr;
+
+    /** 每个内存块的大小（字节） */
+    int32 BlockSize = 0;
+
+    /** 尚未归还的分配数量 */
+    int32 LiveAllocations = 0;
+
+    /** 竞技场所有者是否已销毁 */
+    bool bOwnerReleased = false;
+
+    /** 累计分配字节数（含头部和对齐） */
+    int64 BytesUsed = 0;
+
+    /**
+     * 分配新内存块并从中分配
+     * @param Size 大小
+     * @param Alignment 对齐
+     * @return 对象地址
+     */
+    void* AllocateFromNewBlock(SIZE_T Size, SIZE_T Alignment);
+
+    /**
+     * 释放所有内存块和状态本身
+     */
+    void FreeAll();
+};
+
+/**
+ * 每个分配之前的头部，记录所属竞技场，归还时据此找到状态
+ */
+struct alignas(16) FLatentCommandArenaHeader
+{
+    FLatentCommandArenaState* State;
+};
+
+/**
+ * FLatentCommandArena
+ * 每个测试的Latent命令竞技场
+ * 命令对象和Lambda捕获从连续内存块中按顺序分配，单个命令销毁时不释放内存，
+ * 测试结束后（测试对象和所有命令都已销毁）一次性释放全部内存块
+ * 在TEST_CLASS中声明为成员，每个测试方法获得独立的竞技场：
+ *   FLatentCommandArena Arena{TestRunner};
+ */
+class FLatentCommandArena
+{
+public:
+    /**
+     * 构造函数
+     * @param InTestRunner 用于报告超时错误的测试实例
+     * @param InBlockSize 每个内存块的大小（字节）
+     */
+    explicit FLatentCommandArena(FAutomationTestBase& InTestRunner, int32 InBlockSize = 64 * 1024);
+    ~FLatentCommandArena();
+
+    FLatentCommandArena(const FLatentCommandArena&) = delete;
+    FLatentCommandArena& operator=(const FLatentCommandArena&) = delete;
+
+    /**
+     * 从竞技场分配内存
+     * @param Size 大小
+     * @param Alignment 对齐，至少按16字节对齐
+     * @return 对象地址，需通过 Release 归还
+     */
+    FORCEINLINE void* Allocate(SIZE_T Size, SIZE_T Alignment = 16)
+    {
+        Alignment = FMath::Max<SIZE_T>(Alignment, alignof(FLatentCommandArenaHeader));
+
+        if (State->Cursor == nullptr)
+        {
+            return State->AllocateFromNewBlock(Size, Alignment);
+        }
+
+        uint8* Object = Align(State->Cursor + sizeof(FLatentCommandArenaHeader), Alignment);
+        if (Object + Size > State->End)
+        {
+            return State->AllocateFromNewBlock(Size, Alignment);
+        }
+
+        reinterpret_cast<FLatentCommandArenaHeader*>(Object)[-1].State = State;
+        State->BytesUsed += (Object + Size) - State->Cursor;
+        State->Cursor = Object + Size;
+        ++State->LiveAllocations;
+        return Object;
+    }
+
+    /**
+     * 归还通过 Allocate 分配的内存
+     * 不会立即释放，所有者已销毁且所有分配都已归还时释放整个竞技场
+     * @param Ptr 对象地址
+     */
+    static FORCEINLINE void Release(void* Ptr)
+    {
+        FLatentCommandArenaState* OwnerState = reinterpret_cast<FLatentCommandArenaHeader*>(Ptr)[-1].State;
+        if (--OwnerState->LiveAllocations == 0 && OwnerState->bOwnerReleased)
+        {
+            OwnerState->FreeAll();
+        }
+    }
+
+    /**
+     * 创建一次性执行命令，等同于 new FExecute(...)
+     * @param Function 要执行的Lambda，捕获直接存放在命令对象中
+     * @return 命令，传给AddCommand后由框架持有
+     */
+    template<typename TFunc>
+    IAutomationLatentCommand* Execute(TFunc&& Function);
+
+    /**
+     * 创建条件等待命令，等同于 new FWaitUntil(...)
+     * @param Query 条件
+     * @param Timeout 超时时间（秒）
+     * @return 命令，传给AddCommand后由框架持有
+     */
+    template<typename TFunc>
+    IAutomationLatentCommand* WaitUntil(TFunc&& Query, float Timeout = 5.0f);
+
+    /**
+     * 创建步骤序列命令，步骤通过 Do/Until/Then 追加
+     * 整个序列在框架中只占一个命令，连续完成的步骤在同一帧内执行
+     * @return 序列命令，追加完步骤后传给AddCommand
+     */
+    class FArenaSequenceCommand* Sequence();
+
+    /**
+     * 获取已分配的字节数
+     * @return 字节数
+     */
+    int64 GetBytesUsed() const
+    {
+        return State->BytesUsed;
+    }
+
+    /**
+     * 获取尚未归还的分配数量
+     * @return 分配数量
+     */
+    int32 GetLiveAllocations() const
+    {
+        return State->LiveAllocations;
+    }
+
+    /**
+     * 获取测试实例
+     * @return 测试实例
+     */
+    FAutomationTestBase& GetTestRunner() const
+    {
+        return TestRunner;
+    }
+
+private:
+    FAutomationTestBase& TestRunner;
+    FLatentCommandArenaState* State;
+};
+
+/**
+ * FArenaLatentCommand
+ * 在竞技场中分配的命令基类
+ * 框架通过基类指针delete命令时调用本类的operator delete，只归还分配而不释放内存
+ */
+class FArenaLatentCommand : public IAutomationLatentCommand
+{
+public:
+    static void* operator new(size_t Size, FLatentCommandArena& Arena)
+    {
+        return Arena.Allocate(Size);
+    }
+
+    static void operator delete(void* Ptr, FLatentCommandArena&)
+    {
+        FLatentCommandArena::Release(Ptr);
+    }
+
+    static void operator delete(void* Ptr)
+    {
+        FLatentCommandArena::Release(Ptr);
+    }
+};
+
+/**
+ * TArenaExecuteCommand
+ * 竞技场版本的FExecute，Lambda按值存放在命令对象中，不经过TFunction的堆分配
+ */
+template<typename TFunc>
+class TArenaExecuteCommand : public FArenaLatentCommand
+{
+public:
+    explicit TArenaExecuteCommand(TFunc&& InFunction)
+        : Function(MoveTemp(InFunction))
+    {
+    }
+
+    virtual bool Update() override
+    {
+        Function();
+        return true;
+    }
+
+private:
+    TFunc Function;
+};
+
+/**
+ * TArenaWaitUntilCommand
+ * 竞技场版本的FWaitUntil，超时则测试失败
+ */
+template<typename TFunc>
+class TArenaWaitUntilCommand : public FArenaLatentCommand
+{
+public:
+    TArenaWaitUntilCommand(FAutomationTestBase& InTestRunner, TFunc&& InQuery, float InTimeout)
+        : TestRunner(InTestRunner)
+        , Query(MoveTemp(InQuery))
+        , Timeout(InTimeout)
+    {
+    }
+
+    virtual bool Update() override
+    {
+        if (Query())
+        {
+            return true;
+        }
+
+        if (GetCurrentRunTime() >= Timeout)
+        {
+            TestRunner.AddError(FString::Printf(TEXT("Arena WaitUntil timed out after %.2f seconds"), Timeout));
+            return true;
+        }
+
+        return false;
+    }
+
+private:
+    FAutomationTestBase& TestRunner;
+    TFunc Query;
+    float Timeout;
+};
+
+/**
+ * FArenaSequenceStep
+ * 序列中的单个步骤，以单向链表连接
+ */
+class FArenaSequenceStep
+{
+public:
+    virtual ~FArenaSequenceStep() = default;
+
+    /**
+     * 推进步骤
+     * @param StepStartTime 步骤开始执行的时间（FPlatformTime::Seconds）
+     * @return 步骤是否完成
+     */
+    virtual bool Update(double StepStartTime) = 0;
+
+    FArenaSequenceStep* Next = nullptr;
+};
+
+/**
+ * FArenaSequenceCommand
+ * 竞技场版本的FRunSequence/TestCommandBuilder链
+ * 步骤和捕获都在竞技场中分配，框架每帧只调度这一个命令
+ */
+class FArenaSequenceCommand : public FArenaLatentCommand
+{
+public:
+    explicit FArenaSequenceCommand(FLatentCommandArena& InArena)
+        : Arena(InArena)
+        , TestRunner(InArena.GetTestRunner())
+    {
+    }
+
+    virtual ~FArenaSequenceCommand()
+    {
+        FArenaSequenceStep* Step = Head;
+        while (Step)
+        {
+            FArenaSequenceStep* Next = Step->Next;
+            Step->~FArenaSequenceStep();
+            FLatentCommandArena::Release(Step);
+            Step = Next;
+        }
+    }
+
+    /**
+     * 追加一次性执行步骤
+     * @param Function 要执行的Lambda
+     * @return 序列，便于继续链式调用
+     */
+    template<typename TFunc>
+    FArenaSequenceCommand& Do(TFunc&& Function);
+
+    /**
+     * 追加条件等待步骤，超时从步骤开始执行时计算，超时则测试失败并中止序列
+     * @param Query 条件
+     * @param Timeout 超时时间（秒）
+     * @return 序列，便于继续链式调用
+     */
+    template<typename TFunc>
+    FArenaSequenceCommand& Until(TFunc&& Query, float Timeout = 5.0f);
+
+    /**
+     * 同Do，用于表达前一步完成后的验证
+     * @param Function 要执行的Lambda
+     * @return 序列，便于继续链式调用
+     */
+    template<typename TFunc>
+    FArenaSequenceCommand& Then(TFunc&& Function)
+    {
+        return Do(Forward<TFunc>(Function));
+    }
+
+    /**
+     * 获取步骤数量
+     * @return 步骤数量
+     */
+    int32 GetNumSteps() const
+    {
+        return NumSteps;
+    }
+
+    virtual bool Update() override
+    {
+        while (Current)
+        {
+            if (CurrentStartTime < 0.0)
+            {
+                CurrentStartTime = FPlatformTime::Seconds();
+            }
+
+            if (!Current->Update(CurrentStartTime))
+            {
+                return false;
+            }
+
+            if (bAborted)
+            {
+                return true;
+            }
+
+            Current = Current->Next;
+            CurrentStartTime = -1.0;
+        }
+
+        return true;
+    }
+
+private:
+    template<typename TFunc> friend class TArenaUntilStep;
+
+    void Append(FArenaSequenceStep* Step)
+    {
+        if (Tail)
+        {
+            Tail->Next = Step;
+        }
+        else
+        {
+            Head = Step;
+            Current = Step;
+        }
+        Tail = Step;
+        ++NumSteps;
+    }
+
+    /** 只在追加步骤时使用，序列执行时竞技场所有者可能已销毁 */
+    FLatentCommandArena& Arena;
+    FAutomationTestBase& TestRunner;
+    FArenaSequenceStep* Head = nullptr;
+    FArenaSequenceStep* Tail = nullptr;
+    FArenaSequenceStep* Current = nullptr;
+    double CurrentStartTime = -1.0;
+    int32 NumSteps = 0;
+    bool bAborted = false;
+};
+
+template<typename TFunc>
+class TArenaDoStep : public FArenaSequenceStep
+{
+public:
+    explicit TArenaDoStep(TFunc&& InFunction)
+        : Function(MoveTemp(InFunction))
+    {
+    }
+
+    virtual bool Update(double StepStartTime) override
+    {
+        Function();
+        return true;
+    }
+
+private:
+    TFunc Function;
+};
+
+template<typename TFunc>
+class TArenaUntilStep : public FArenaSequenceStep
+{
+public:
+    TArenaUntilStep(FArenaSequenceCommand& InOwner, TFunc&& InQuery, float InTimeout)
+        : Owner(InOwner)
+        , Query(MoveTemp(InQuery))
+        , Timeout(InTimeout)
+    {
+    }
+
+    virtual bool Update(double StepStartTime) override
+    {
+        if (Query())
+        {
+            return true;
+        }
+
+        if (FPlatformTime::Seconds() - StepStartTime >= Timeout)
+        {
+            Owner.TestRunner.AddError(FString::Printf(TEXT("Arena sequence Until timed out after %.2f seconds"), Timeout));
+            Owner.bAborted = true;
+            return true;
+        }
+
+        return false;
+    }
+
+private:
+    FArenaSequenceCommand& Owner;
+    TFunc Query;
+    float Timeout;
+};
+
+// 模板实现
+
+template<typename TFunc>
+IAutomationLatentCommand* FLatentCommandArena::Execute(TFunc&& Function)
+{
+    using FCommand = TArenaExecuteCommand<std::decay_t<TFunc>>;
+    return new (*this) FCommand(std::decay_t<TFunc>(Forward<TFunc>(Function)));
+}
+
+template<typename TFunc>
+IAutomationLatentCommand* FLatentCommandArena::WaitUntil(TFunc&& Query, float Timeout)
+{
+    using FCommand = TArenaWaitUntilCommand<std::decay_t<TFunc>>;
+    return new (*this) FCommand(TestRunner, std::decay_t<TFunc>(Forward<TFunc>(Query)), Timeout);
+}
+
+inline FArenaSequenceCommand* FLatentCommandArena::Sequence()
+{
+    return new (*this) FArenaSequenceCommand(*this);
+}
+
+template<typename TFunc>
+FArenaSequenceCommand& FArenaSequenceCommand::Do(TFunc&& Function)
+{
+    using FStep = TArenaDoStep<std::decay_t<TFunc>>;
+    void* Memory = Arena.Allocate(sizeof(FStep), alignof(FStep));
+    Append(new (Memory) FStep(std::decay_t<TFunc>(Forward<TFunc>(Function))));
+    return *this;
+}
+
+template<typename TFunc>
+FArenaSequenceCommand& FArenaSequenceCommand::Until(TFunc&& Query, float Timeout)
+{
+    using FStep = TArenaUntilStep<std::decay_t<TFunc>>;
+    void* Memory = Arena.Allocate(sizeof(FStep), alignof(FStep));
+    Append(new (Memory) FStep(*this, std::decay_t<TFunc>(Forward<TFunc>(Query)), Timeout));
+    return *this;
+}
@@ -0,0 +1,457 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Commands/TestCommandBuilder.h"
+#include "Helpers/ActorTestHelper.h"
+
+#include <type_traits>
+
+/**
+ * TIsDelegatePredicate
+ * PredicateType 能否以多播委托的参数调用并返回bool
+ * 用于约束带条件的等待重载，数值超时等参数不会误选这些重载
+ */
+template<typename DelegateType, typename PredicateType>
+struct TIsDelegatePredicate
+{
+    static constexpr bool Value = false;
+};
+
+template<typename... ParamTypes, typename UserPolicy, typename PredicateType>
+struct TIsDelegatePredicate<TMulticastDelegate<void(ParamTypes...), UserPolicy>, PredicateType>
+{
+    static constexpr bool Value = std::is_invocable_r_v<bool, const std::decay_t<PredicateType>&, ParamTypes&...>;
+};
+
+/**
+ * TDelegateWaiter
+ * 订阅多播委托并记录触发次数
+ * 委托触发时只递增计数，等待方只读取计数，不需要逐帧求值条件
+ * 委托的所有者必须比Waiter存活更久
+ * @tparam DelegateType 多播委托类型
+ */
+template<typename DelegateType>
+class TDelegateWaiter
+{
+public:
+    /**
+     * 构造函数，立即订阅委托
+     * @param InDelegate 要等待的多播委托
+     */
+    explicit TDelegateWaiter(DelegateType& InDelegate)
+        : Delegate(InDelegate)
+        , FireCount(0)
+    {
+        Handle = Delegate.AddLambda([this](auto&&...) {
+            ++FireCount;
+        });
+    }
+
+    /**
+     * 构造函数，立即订阅委托，只记录参数满足条件的触发
+     * @param InDelegate 要等待的多播委托
+     * @param Predicate 以委托参数调用的条件，返回true时计数
+     */
+    template<typename PredicateType, typename = std::enable_if_t<TIsDelegatePredicate<DelegateType, PredicateType>::Value>>
+    TDelegateWaiter(DelegateType& InDelegate, PredicateType&& Predicate)
+        : Delegate(InDelegate)
+        , FireCount(0)
+    {
+        Handle = Delegate.AddLambda([this, Predicate = Forward<PredicateType>(Predicate)](auto&&... Args) {
+            if (Predicate(Args...))
+            {
+                ++FireCount;
+            }
+        });
+    }
+
+    ~TDelegateWaiter()
+    {
+        Delegate.Remove(Handle);
+    }
+
+    TDelegateWaiter(const TDelegateWaiter&) = delete;
+    TDelegateWaiter& operator=(const TDelegateWaiter&) = delete;
+
+    /**
+     * 委托是否已触发
+     * @return 是否已触发
+     */
+    bool HasFired() const
+    {
+        return FireCount > 0;
+    }
+
+    /**
+     * 获取订阅以来的触发次数
+     * @return 触发次数
+     */
+    int32 GetFireCount() const
+    {
+        return FireCount;
+    }
+
+    /**
+     * 清零触发次数，用于等待下一次触发
+     */
+    void Reset()
+    {
+        FireCount = 0;
+    }
+
+private:
+    DelegateType& Delegate;
+    FDelegateHandle Handle;
+    int32 FireCount;
+};
+
+/**
+ * TWaitForDelegate
+ * 事件驱动的Latent Action：委托触发时完成，超时则测试失败
+ * 订阅发生在命令创建时，先于本命令开始执行触发的事件同样会被记录
+ * @tparam DelegateType 多播委托类型
+ */
+template<typename DelegateType>
+class TWaitForDelegate : public IAutomationLatentCommand
+{
+public:
+    /**
+     * 构造函数
+     * @param InTestRunner 用于报告超时错误的测试实例
+     * @param InDelegate 要等待的多播委托
+     * @param InTimeout 超时时间（秒）
+     */
+    TWaitForDelegate(FAutomationTestBase& InTestRunner, DelegateType& InDelegate, float InTimeout = 5.0f)
+        : TestRunner(InTestRunner)
+        , Waiter(InDelegate)
+        , Timeout(InTimeout)
+    {
+    }
+
+    /**
+     * 构造函数，只在委托参数满足条件时完成
+     * @param InTestRunner 用于报告超时错误的测试实例
+     * @param InDelegate 要等待的多播委托
+     * @param Predicate 以委托参数调用的条件
+     * @param InTimeout 超时时间（秒）
+     */
+    template<typename PredicateType, typename = std::enable_if_t<TIsDelegatePredicate<DelegateType, PredicateType>::Value>>
+    TWaitForDelegate(FAutomationTestBase& InTestRunner, DelegateType& InDelegate, PredicateType&& Predicate, float InTimeout = 5.0f)
+        : TestRunner(InTestRunner)
+        , Waiter(InDelegate, Forward<PredicateType>(Predicate))
+        , Timeout(InTimeout)
+    {
+    }
+
+    virtual bool Update() override
+    {
+        if (Waiter.HasFired())
+        {
+            return true;
+        }
+
+        if (GetCurrentRunTime() >= Timeout)
+        {
+            TestRunner.AddError(FString::Printf(TEXT("TWaitForDelegate timed out after %.2f seconds"), Timeout));
+            return true;
+        }
+
+        return false;
+    }
+
+private:
+    FAutomationTestBase& TestRunner;
+    TDelegateWaiter<DelegateType> Waiter;
+    float Timeout;
+};
+
+/**
+ * 在TestCommandBuilder链中等待委托触发
+ * 调用时立即订阅，链中等待步骤只检查触发标志
+ * @param Builder 测试中的TestCommandBuilder
+ * @param Delegate 要等待的多播委托
+ * @param Timeout 超时时间（秒）
+ * @return Builder，便于继续链式调用
+ */
+template<typename DelegateType>
+FTestCommandBuilder& UntilEvent(FTestCommandBuilder& Builder, DelegateType& Delegate, float Timeout = 5.0f)
+{
+    TSharedRef<TDelegateWaiter<DelegateType>> Waiter = MakeShared<TDelegateWaiter<DelegateType>>(Delegate);
+
+    return Builder.Until([Waiter]() {
+        return Waiter->HasFired();
+    }, Timeout);
+}
+
+/**
+ * 在TestCommandBuilder链中等待委托以满足条件的参数触发
+ * @param Builder 测试中的TestCommandBuilder
+ * @param Delegate 要等待的多播委托
+ * @param Predicate 以委托参数调用的条件
+ * @param Timeout 超时时间（秒）
+ * @return Builder，便于继续链式调用
+ */
+template<typename DelegateType, typename PredicateType, typename = std::enable_if_t<TIsDelegatePredicate<DelegateType, PredicateType>::Value>>
+FTestCommandBuilder& UntilEvent(FTestCommandBuilder& Builder, DelegateType& Delegate, PredicateType&& Predicate, float Timeout = 5.0f)
+{
+    TSharedRef<TDelegateWaiter<DelegateType>> Waiter = MakeShared<TDelegateWaiter<DelegateType>>(Delegate, Forward<PredicateType>(Predicate));
+
+    return Builder.Until([Waiter]() {
+        return Waiter->HasFired();
+    }, Timeout);
+}
+
+/**
+ * FTestVirtualClock
+ * 虚拟时钟：延时和超时按测试世界的模拟时间计算，而不是真实时间
+ * 时间由 ActorTestSpawner::AdvanceWorld 以固定步长推进，速度只受机器Tick速度限制
+ * 通过 USE_VIRTUAL_TIME 在TEST_CLASS中按类启用
+ */
+class FTestVirtualClock
+{
+public:
+    /**
+     * 构造函数
+     * @param InSpawner 提供测试世界的Spawner
+     * @param InFixedDeltaSeconds 每帧模拟步长（秒）
+     * @param InMaxFramesPerUpdate 每次Latent Update最多推进的帧数，0表示不限制（在一次Update内推进到完成）
+     */
+    FTestVirtualClock(ActorTestSpawner& InSpawner, float InFixedDeltaSeconds = 1.0f / 60.0f, int32 InMaxFramesPerUpdate = 0);
+
+    /**
+     * 获取当前虚拟时间
+     * @return 测试世界的累计模拟时间（秒）
+     */
+    double Now() const;
+
+    /**
+     * 推进指定帧数
+     * @param NumFrames 帧数
+     */
+    void Step(int32 NumFrames = 1);
+
+    /**
+     * 获取每帧模拟步长
+     * @return 步长（秒）
+     */
+    float GetFixedDeltaSeconds() const;
+
+    /**
+     * 获取每次Latent Update最多推进的帧数
+     * @return 帧数，0表示不限制
+     */
+    int32 GetMaxFramesPerUpdate() const;
+
+    /**
+     * 获取绑定的Spawner
+     * @return Spawner
+     */
+    ActorTestSpawner& GetSpawner() const;
+
+private:
+    ActorTestSpawner& Spawner;
+    float FixedDeltaSeconds;
+    int32 MaxFramesPerUpdate;
+};
+
+/**
+ * 为TEST_CLASS启用虚拟时间
+ * 声明名为VirtualClock的成员，绑定到已声明的ActorTestSpawner成员，可选参数同FTestVirtualClock构造函数
+ */
+#define USE_VIRTUAL_TIME(SpawnerMember, ...) FTestVirtualClock VirtualClock{SpawnerMember, ##__VA_ARGS__}
+
+/**
+ * FVirtualWaitDelay
+ * 按虚拟时间等待的FWaitDelay
+ * 每次Update以固定步长推进世界，模拟时间达到延时后完成
+ */
+class FVirtualWaitDelay : public IAutomationLatentCommand
+{
+public:
+    /**
+     * 构造函数
+     * @param InClock 虚拟时钟
+     * @param InDelaySeconds 延时（模拟秒）
+     */
+    FVirtualWaitDelay(FTestVirtualClock& InClock, float InDelaySeconds);
+
+    virtual bool Update() override;
+
+private:
+    FTestVirtualClock& Clock;
+    float DelaySeconds;
+
+    /** 首次Update时的虚拟时间，未开始时为负 */
+    double VirtualStartTime;
+};
+
+/**
+ * FVirtualWaitUntil
+ * 按虚拟时间计算超时的FWaitUntil
+ * 每推进一帧检查一次条件，条件在模拟时间内未满足则测试失败
+ */
+class FVirtualWaitUntil : public IAutomationLatentCommand
+{
+public:
+    /**
+     * 构造函数
+     * @param InTestRunner 用于报告超时错误的测试实例
+     * @param InClock 虚拟时钟
+     * @param InQuery 条件
+     * @param InTimeout 超时时间（模拟秒）
+     */
+    FVirtualWaitUntil(FAutomationTestBase& InTestRunner, FTestVirtualClock& InClock, TFunction<bool()> InQuery, float InTimeout = 5.0f);
+
+    virtual bool Update() override;
+
+private:
+    FAutomationTestBase& TestRunner;
+    FTestVirtualClock& Clock;
+    TFunction<bool()> Query;
+    float Timeout;
+
+    /** 首次Update时的虚拟时间，未开始时为负 */
+    double VirtualStartTime;
+};
+
+/**
+ * FLatentWaitRecord
+ * 一次等待的实际耗时记录
+ */
+struct FLatentWaitRecord
+{
+    /** 所属测试全名 */
+    FString TestName;
+
+    /** 等待标签，建议描述等待的条件（如 "Replication.Health"） */
+    FString Label;
+
+    /** 条件成立前经过的帧数（Update次数） */
+    int32 Frames = 0;
+
+    /** 条件成立前经过的时间（秒） */
+    double WaitSeconds = 0.0;
+
+    /** 设置的超时时间（秒） */
+    double TimeoutSeconds = 0.0;
+
+    /** 是否超时 */
+    bool bTimedOut = false;
+
+    /**
+     * 剩余超时余量占超时时间的比例，越接近0越容易在慢机器上误判
+     * @return 0~1之间的比例
+     */
+    double GetHeadroomRatio() const
+    {
+        return TimeoutSeconds > 0.0 ? FMath::Clamp(1.0 - WaitSeconds / TimeoutSeconds, 0.0, 1.0) : 0.0;
+    }
+};
+
+/**
+ * FLatentWaitProfiler
+ * 统计整个测试套件中等待的实际耗时与超时余量
+ * 通过 FAutomationTestFramework 的测试开始/结束事件记录每个测试的总耗时，
+ * 所有测试结束后输出两份排行：耗时最长的等待，以及等待时间占测试耗时比例最高的测试
+ * 命令行带 -ProfileLatentWaits 时自动在套件结束时写入 Saved/Automation/LatentWaits.txt
+ */
+class FLatentWaitProfiler
+{
+public:
+    /**
+     * 获取全局实例，首次调用时订阅测试框架事件
+     * @return 分析器
+     */
+    static FLatentWaitProfiler& Get();
+
+    /**
+     * 记录一次等待，测试名取当前正在运行的测试
+     * @param Record 等待记录
+     */
+    void Record(FLatentWaitRecord&& Record);
+
+    /**
+     * 生成报告文本
+     * @param TopN 每份排行的条目数
+     * @return 报告文本
+     */
+    FString BuildReport(int32 TopN = 20) const;
+
+    /**
+     * 将报告写入文件，同时输出到日志
+     * @param FilePath 输出文件路径
+     * @param TopN 每份排行的条目数
+     * @return 是否成功
+     */
+    bool WriteReport(const FString& FilePath, int32 TopN = 20) const;
+
+    /**
+     * 清空全部记录
+     */
+    void Reset();
+
+    /**
+     * 获取全部记录
+     * @return 记录数组
+     */
+    const TArray<FLatentWaitRecord>& GetRecords() const;
+
+    /**
+     * 注册控制台命令 Automation.LatentWaitReport [TopN] [FilePath]
+     */
+    static void RegisterConsoleCommands();
+
+private:
+    FLatentWaitProfiler();
+
+    void OnTestStart(FAutomationTestBase* Test);
+    void OnTestEnd(FAutomationTestBase* Test);
+    void OnAfterAllTests();
+
+    TArray<FLatentWaitRecord> Records;
+
+    /** 测试全名到测试总耗时（秒） */
+    TMap<FString, double> TestDurations;
+
+    FString CurrentTestName;
+    double CurrentTestStartTime;
+};
+
+/**
+ * FProfiledWaitUntil
+ * 记录实际耗时的FWaitUntil
+ * 条件成立或超时时把帧数、耗时和超时余量交给 FLatentWaitProfiler
+ */
+class FProfiledWaitUntil : public IAutomationLatentCommand
+{
+public:
+    /**
+     * 构造函数
+     * @param InTestRunner 用于报告超时错误的测试实例
+     * @param InLabel 等待标签
+     * @param InQuery 条件
+     * @param InTimeout 超时时间（秒）
+     */
+    FProfiledWaitUntil(FAutomationTestBase& InTestRunner, const FString& InLabel, TFunction<bool()> InQuery, float InTimeout = 5.0f);
+
+    virtual bool Update() override;
+
+private:
+    FAutomationTestBase& TestRunner;
+    FString Label;
+    TFunction<bool()> Query;
+    float Timeout;
+    int32 Frames;
+};
+
+/**
+ * 在TestCommandBuilder链中等待条件并记录实际耗时
+ * 用法与 Builder.Until 相同；超时时链被中止，未完成的等待在记录状态销毁时按超时记录
+ * @param Builder 测试中的TestCommandBuilder
+ * @param Label 等待标签
+ * @param Query 条件
+ * @param Timeout 超时时间（秒）
+ * @return Builder，便于继续链式调用
+ */
+FTestCommandBuilder& ProfiledUntil(FTestCommandBuilder& Builder, const FString& Label, TFunction<bool()> Query, float Timeout = 5.0f);
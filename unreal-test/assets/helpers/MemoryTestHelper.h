@@ -0,0 +1,196 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/MemoryBase.h"
+#include "UObject/UObjectArray.h"
+
+/**
+ * FTestMemoryStats
+ * 一个测量作用域内的内存与GC统计
+ */
+struct FTestMemoryStats
+{
+    /** 当前线程的堆分配次数 */
+    int64 AllocationCount = 0;
+
+    /** 当前线程的堆分配字节数 */
+    int64 AllocatedBytes = 0;
+
+    /** 当前线程的释放次数 */
+    int64 FreeCount = 0;
+
+    /** 创建的UObject数量 */
+    int32 UObjectsCreated = 0;
+
+    /** 销毁的UObject数量 */
+    int32 UObjectsDestroyed = 0;
+
+    /** GC次数 */
+    int32 GCPasses = 0;
+
+    /** GC总耗时（秒） */
+    double GCSeconds = 0.0;
+
+    /** 作用域内采样到的最大物理内存占用（字节） */
+    uint64 PeakUsedPhysicalBytes = 0;
+
+    /**
+     * 格式化为一行摘要
+     * @return 摘要文本
+     */
+    FString ToString() const;
+};
+
+/**
+ * FTestAllocationCounter
+ * 包装GMalloc的分配计数代理，按线程统计分配次数和字节数
+ * 代理只转发调用，安装前由原分配器分配的内存可以照常释放；
+ * 需要在测试模块启动时安装，命令行未带 -TestAllocTracking 时不安装，计数保持为0
+ */
+class FTestAllocationCounter : public FMalloc
+{
+public:
+    /**
+     * 在命令行带 -TestAllocTracking 时安装代理
+     * @return 是否已安装
+     */
+    static bool InstallIfRequested();
+
+    /**
+     * 代理是否已安装
+     * @return 是否已安装
+     */
+    static bool IsInstalled();
+
+    /**
+     * 获取当前线程的累计分配次数
+     * @return 分配次数
+     */
+    static int64 GetThreadAllocationCount();
+
+    /**
+     * 获取当前线程的累计分配字节数
+     * @return 字节数
+     */
+    static int64 GetThreadAllocatedBytes();
+
+    /**
+     * 获取当前线程的累计释放次数
+     * @return 释放次数
+     */
+    static int64 GetThreadFreeCount();
+
+    // FMalloc
+    virtual void* Malloc(SIZE_T Size, uint32 Alignment) override;
+    virtual void* Realloc(void* Original, SIZE_T Size, uint32 Alignment) override;
+    virtual void Free(void* Original) override;
+    virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override;
+    virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override;
+    virtual void Trim(bool bTrimThreadCaches) override;
+    virtual void SetupTLSCachesOnCurrentThread() override;
+    virtual void ClearAndDisableTLSCachesOnCurrentThread() override;
+    virtual bool IsInternallyThreadSafe() const override;
+    virtual void UpdateStats() override;
+    virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override;
+    virtual const TCHAR* GetDescriptiveName() override;
+
+private:
+    explicit FTestAllocationCounter(FMalloc* InInnerMalloc);
+
+    FMalloc* InnerMalloc;
+};
+
+/**
+ * FTestMemoryScope
+ * 测量作用域：记录构造到析构之间的堆分配、UObject创建/销毁、GC次数与耗时和峰值内存，
+ * 析构时把摘要写入测试日志
+ * 通过 MEASURE_TEST_MEMORY 声明为TEST_CLASS成员时，CQTest为每个测试方法创建新的测试对象，
+ * 作用域覆盖 BEFORE_EACH、测试方法和 AFTER_EACH
+ */
+class FTestMemoryScope : public FUObjectArray::FUObjectCreateListener, public FUObjectArray::FUObjectDeleteListener
+{
+public:
+    /**
+     * 构造函数，开始测量
+     * @param InTestRunner 写入结果的测试实例
+     */
+    explicit FTestMemoryScope(FAutomationTestBase& InTestRunner);
+    virtual ~FTestMemoryScope();
+
+    FTestMemoryScope(const FTestMemoryScope&) = delete;
+    FTestMemoryScope& operator=(const FTestMemoryScope&) = delete;
+
+    /**
+     * 获取到目前为止的统计
+     * @return 统计结果
+     */
+    FTestMemoryStats GetStats() const;
+
+    // FUObjectCreateListener
+    virtual void NotifyUObjectCreated(const UObjectBase* Object, int32 Index) override;
+    virtual void OnUObjectArrayShutdown() override;
+
+    // FUObjectDeleteListener
+    virtual void NotifyUObjectDeleted(const UObjectBase* Object, int32 Index) override;
+
+private:
+    void OnPreGarbageCollect();
+    void OnPostGarbageCollect();
+    void SamplePeakMemory();
+
+    FAutomationTestBase& TestRunner;
+    FTestMemoryStats Stats;
+    int64 StartAllocationCount;
+    int64 StartAllocatedBytes;
+    int64 StartFreeCount;
+    double GCStartTime;
+    FDelegateHandle PreGCHandle;
+    FDelegateHandle PostGCHandle;
+};
+
+/**
+ * 为TEST_CLASS的每个测试方法启用内存测量
+ */
+#define MEASURE_TEST_MEMORY() FTestMemoryScope TestMemoryScope{TestRunner}
+
+/**
+ * FTestNoAllocationScope
+ * EXPECT_NO_ALLOCATIONS 的实现：作用域结束时当前线程有堆分配则报告错误
+ */
+class FTestNoAllocationScope
+{
+public:
+    FTestNoAllocationScope(FAutomationTestBase& InTestRunner, const TCHAR* InFile, int32 InLine);
+    ~FTestNoAllocationScope();
+
+    /**
+     * 供for循环使用：第一次返回true执行块，之后返回false
+     * @return 是否执行块
+     */
+    bool Once()
+    {
+        return !bEntered && (bEntered = true);
+    }
+
+private:
+    FAutomationTestBase& TestRunner;
+    const TCHAR* File;
+    int32 Line;
+    int64 StartAllocationCount;
+    int64 StartAllocatedBytes;
+    bool bEntered;
+};
+
+/**
+ * EXPECT_NO_ALLOCATIONS
+ * 检查块内的代码在当前线程上没有堆分配：
+ *   EXPECT_NO_ALLOCATIONS
+ *   {
+ *       Component->TickHotPath(DeltaTime);
+ *   }
+ * 失败时报告错误（含分配次数与字节数），不提前返回，块之后的代码仍会执行，因此命名为EXPECT而非ASSERT；
+ * 未安装分配计数代理时报告警告
+ */
+#define EXPECT_NO_ALLOCATIONS \
+    for (FTestNoAllocationScope NoAllocationScope(TestRunner, TEXT(__FILE__), __LINE__); NoAllocationScope.Once(); )
@@ -0,0 +1,145 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Algo/AllOf.h"
+#include "Helpers/ActorTestHelper.h"
+
+/**
+ * FMultiWorldTestContext
+ * 一个独立的测试世界上下文，由 FMultiWorldTestRunner 创建并持有其 ActorTestSpawner
+ */
+struct FMultiWorldTestContext
+{
+    /** 上下文名称，用于报告 */
+    FString Name;
+
+    /** 世界初始化后调用一次，生成该上下文需要的Actor */
+    TFunction<void(ActorTestSpawner&)> Setup;
+
+    /** 每推进一个时间片后调用，返回true表示该上下文完成 */
+    TFunction<bool(ActorTestSpawner&)> IsComplete;
+
+    /** 最长模拟时间（秒），超过后该上下文记为未完成 */
+    float MaxSimulatedSeconds = 10.0f;
+
+    /**
+     * 是否退出交错执行
+     * 访问全局单例（引擎子系统、静态变量、配置等）的上下文设为true，
+     * 在所有交错上下文结束后单独串行运行
+     */
+    bool bRequiresSerialExecution = false;
+};
+
+/**
+ * FMultiWorldContextResult
+ * 单个上下文的运行结果
+ */
+struct FMultiWorldContextResult
+{
+    FString Name;
+    bool bCompleted = false;
+    double SimulatedSeconds = 0.0;
+    uint64 SimulatedFrames = 0;
+
+    /** 该上下文自身Setup和Tick的实际耗时（秒） */
+    double WallSeconds = 0.0;
+};
+
+/**
+ * FMultiWorldRunReport
+ * 一次多世界运行的汇总
+ */
+struct FMultiWorldRunReport
+{
+    TArray<FMultiWorldContextResult> Results;
+
+    /** 整次运行的实际耗时（秒） */
+    double WallSeconds = 0.0;
+
+    /** 各上下文模拟时间之和（秒），不是实测的串行运行耗时 */
+    double TotalSimulatedSeconds = 0.0;
+
+    /**
+     * 逐个串行运行各上下文的实际耗时（秒），为各上下文自身 WallSeconds 之和
+     * 每个上下文的 WallSeconds 只计其自身的Setup和Tick，与单独运行该上下文的耗时相同
+     */
+    double SerialWallSeconds = 0.0;
+
+    /**
+     * 相对逐个串行运行的加速比
+     * @return SerialWallSeconds / WallSeconds，未运行时返回0
+     */
+    double GetSpeedupVsSerial() const
+    {
+        return WallSeconds > 0.0 ? SerialWallSeconds / WallSeconds : 0.0;
+    }
+
+    /**
+     * 模拟时间与实际耗时之比，即每实际秒推进的模拟秒数
+     * @return 比值，未运行时返回0
+     */
+    double GetSimulatedToWallRatio() const
+    {
+        return WallSeconds > 0.0 ? TotalSimulatedSeconds / WallSeconds : 0.0;
+    }
+
+    /**
+     * 所有上下文是否都已完成
+     * @return 是否全部完成
+     */
+    bool AllCompleted() const
+    {
+        return Results.Num() > 0 && Algo::AllOf(Results, [](const FMultiWorldContextResult& Result) { return Result.bCompleted; });
+    }
+};
+
+/**
+ * FMultiWorldTestRunner
+ * 在游戏线程上交错运行多个互不共享状态的测试世界
+ * 每个上下文拥有独立的 ActorTestSpawner，运行器轮流以固定步长推进各世界一个时间片；
+ * UWorld只能在游戏线程Tick，跨核并行需要配合进程分片
+ */
+class FMultiWorldTestRunner
+{
+public:
+    /**
+     * 构造函数
+     * @param InFixedDeltaSeconds 每帧模拟步长（秒）
+     * @param InFramesPerSlice 每个上下文每轮推进的帧数
+     */
+    FMultiWorldTestRunner(float InFixedDeltaSeconds = 1.0f / 60.0f, int32 InFramesPerSlice = 1);
+    ~FMultiWorldTestRunner();
+
+    /**
+     * 添加上下文
+     * @param Context 上下文描述
+     */
+    void AddContext(FMultiWorldTestContext Context);
+
+    /**
+     * 获取上下文数量
+     * @return 上下文数量
+     */
+    int32 GetNumContexts() const;
+
+    /**
+     * 运行所有上下文
+     * 先交错运行未设置 bRequiresSerialExecution 的上下文，再逐个运行其余上下文；
+     * 每个上下文结束后立即销毁其世界
+     * @return 运行汇总
+     */
+    FMultiWorldRunReport Run();
+
+    /**
+     * 将运行汇总写入测试日志（每个上下文的结果、相对串行运行的加速比与模拟/实际时间比）
+     * @param TestRunner 测试实例
+     * @param Report 运行汇总
+     */
+    static void LogReport(FAutomationTestBase& TestRunner, const FMultiWorldRunReport& Report);
+
+private:
+    TArray<FMultiWorldTestContext> Contexts;
+    float FixedDeltaSeconds;
+    int32 FramesPerSlice;
+};
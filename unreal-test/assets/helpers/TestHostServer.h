@@ -0,0 +1,99 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+
+class FSocket;
+
+/**
+ * FTestHostServer
+ * 常驻测试宿主：编辑器进程保持运行，通过本地TCP端口接收运行请求，
+ * 省去每次运行的引擎启动和资源加载
+ *
+ * 协议为逐行文本（UTF-8）：
+ *   run <TestFilter>   运行匹配的测试，逐行返回 "PASS|FAIL <TestName> <Seconds>"，以 "DONE" 结束
+ *   rerun              使用上一次的过滤条件重新运行
+ *   reload             触发Live Coding编译，补丁生效后返回 "RELOADED"
+ *   status             返回宿主状态
+ *   quit               断开连接
+ */
+class FTestHostServer
+{
+public:
+    /**
+     * 构造函数
+     * @param InPort 监听端口，只绑定到127.0.0.1
+     */
+    explicit FTestHostServer(uint16 InPort = 7788);
+    ~FTestHostServer();
+
+    /**
+     * 开始监听
+     * @return 是否成功
+     */
+    bool Start();
+
+    /**
+     * 停止监听并断开所有连接
+     */
+    void Stop();
+
+    /**
+     * 是否正在监听
+     * @return 是否正在监听
+     */
+    bool IsRunning() const;
+
+    /**
+     * 设置测试模块重新加载（热重载或Live Coding补丁）后是否自动重新运行上一次的过滤条件
+     * @param bEnable 是否启用
+     */
+    void SetRerunOnReload(bool bEnable);
+
+    /**
+     * 将资源加入根集，使其在多次运行之间不被GC回收
+     * BEFORE_ALL中加载的资源保留后，再次运行时LoadObject直接命中内存
+     * @param Asset 要保留的资源
+     */
+    static void RetainAsset(UObject* Asset);
+
+    /**
+     * 释放所有通过 RetainAsset 保留的资源
+     */
+    static void ReleaseRetainedAssets();
+
+    /**
+     * 注册控制台命令 Automation.StartTestHost [Port] 与 Automation.StopTestHost
+     */
+    static void RegisterConsoleCommands();
+
+private:
+    /**
+     * 由FTSTicker每帧调用：接受新连接、读取请求、推进正在运行的测试
+     */
+    bool Tick(float DeltaSeconds);
+
+    /**
+     * 处理一行请求
+     */
+    void HandleCommand(const FString& Command, FSocket* Client);
+
+    /**
+     * 通过自动化框架运行匹配过滤条件的测试，完成后把结果写回客户端
+     */
+    void RunTests(const FString& TestFilter, FSocket* Client);
+
+    /**
+     * 测试模块重新加载完成时调用
+     */
+    void OnModulesReloaded();
+
+    uint16 Port;
+    FSocket* ListenSocket;
+    TArray<FSocket*> Clients;
+    FTSTicker::FDelegateHandle TickHandle;
+    FDelegateHandle ReloadHandle;
+    FString LastTestFilter;
+    FSocket* LastClient;
+    bool bRerunOnReload;
+};
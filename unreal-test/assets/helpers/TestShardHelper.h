@@ -0,0 +1,108 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/Crc.h"
+
+/**
+ * FTestShardSpec
+ * 分片描述，对应命令行参数 -TestShard=Index/Count
+ */
+struct FTestShardSpec
+{
+    /** 当前分片序号，从0开始 */
+    int32 Index = 0;
+
+    /** 分片总数 */
+    int32 Count = 1;
+
+    bool IsValid() const
+    {
+        return Count > 0 && Index >= 0 && Index < Count;
+    }
+};
+
+/**
+ * FTestShardResult
+ * 合并报告中的单个测试结果
+ */
+struct FTestShardResult
+{
+    FString FullTestName;
+    bool bPassed = false;
+    double DurationSeconds = 0.0;
+
+    /** 运行该测试的分片序号 */
+    int32 ShardIndex = INDEX_NONE;
+};
+
+/**
+ * FTestShardHelper
+ * 进程级测试分片：在多个 -nullrhi 进程间确定性地划分测试，并合并各分片的报告
+ */
+class FTestShardHelper
+{
+public:
+    /**
+     * 从命令行解析 -TestShard=Index/Count
+     * @param CommandLine 命令行
+     * @param OutSpec 解析结果
+     * @return 是否存在合法的分片参数
+     */
+    static bool ParseCommandLine(const TCHAR* CommandLine, FTestShardSpec& OutSpec);
+
+    /**
+     * 按测试全名哈希判断是否属于指定分片
+     * 哈希只取决于名称，不同进程、不同机器上划分结果一致
+     * @param FullTestName 测试全名（如 Game.Actor.YourActorTestClass.SpawnActor_ShouldSucceed）
+     * @param Spec 分片描述
+     * @return 是否属于该分片
+     */
+    static bool IsInShardByHash(const FString& FullTestName, const FTestShardSpec& Spec)
+    {
+        return Spec.IsValid() && FCrc::StrCrc32(*FullTestName) % static_cast<uint32>(Spec.Count) == static_cast<uint32>(Spec.Index);
+    }
+
+    /**
+     * 按历史耗时划分测试，使各分片总耗时接近
+     * 按耗时降序（同耗时按名称）逐个分配给当前总耗时最小的分片，无历史记录的测试按中位耗时估算
+     * @param TestNames 所有测试全名
+     * @param HistoricalDurations 测试全名到历史耗时（秒）的映射
+     * @param Spec 分片描述
+     * @return 属于该分片的测试全名
+     */
+    static TArray<FString> PartitionByDuration(const TArray<FString>& TestNames, const TMap<FString, double>& HistoricalDurations, const FTestShardSpec& Spec);
+
+    /**
+     * 从上一次运行的报告（-ReportExportPath 下的 index.json）读取各测试耗时
+     * @param ReportDirectory 报告目录
+     * @param OutDurations 测试全名到耗时（秒）的映射
+     * @return 是否读取成功
+     */
+    static bool LoadHistoricalDurations(const FString& ReportDirectory, TMap<FString, double>& OutDurations);
+
+    /**
+     * 枚举匹配过滤前缀的测试，并返回属于指定分片的部分
+     * @param Filter 测试名前缀（如 "Game."）
+     * @param Spec 分片描述
+     * @param HistoricalDurations 历史耗时，为nullptr时按名称哈希划分
+     * @return 属于该分片的测试全名
+     */
+    static TArray<FString> GetShardTestNames(const FString& Filter, const FTestShardSpec& Spec, const TMap<FString, double>* HistoricalDurations = nullptr);
+
+    /**
+     * 合并各分片的报告
+     * 输出一个 index.json，包含所有测试的结果、耗时和所属分片
+     * @param ShardReportDirectories 各分片的 -ReportExportPath 目录
+     * @param OutputDirectory 合并报告目录
+     * @param OutResults 合并后的结果，按测试全名排序
+     * @return 是否所有分片报告都读取成功
+     */
+    static bool MergeReports(const TArray<FString>& ShardReportDirectories, const FString& OutputDirectory, TArray<FTestShardResult>& OutResults);
+
+    /**
+     * 注册控制台命令
+     * - Automation.RunTestShard <Filter> [DurationReportDir]：读取 -TestShard 并运行属于本分片的测试
+     * - Automation.MergeShardReports <OutputDir> <ShardDir1> <ShardDir2> ...：合并分片报告
+     */
+    static void RegisterConsoleCommands();
+};
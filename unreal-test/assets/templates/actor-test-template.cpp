@@ -77,12 +77,13 @@ TEST_CLASS(YourActorTestClass, "Game.Actor")
     // 测试多个Actor
     TEST_METHOD(MultipleActors_ShouldAllSpawn)
     {
-        TArray<AYourActor*> Actors;
+        // 批量生成：整批延迟构造后集中完成生成
+        TArray<AYourActor*> Actors = Spawner.SpawnActorsBatch<AYourActor>(5, [](int32 Index) {
+            return FTransform(FVector(Index * 100, 0, 0));
+        });
 
-        for (int32 i = 0; i < 5; i++)
+        for (AYourActor* Actor : Actors)
         {
-            AYourActor* Actor = Spawner.SpawnActor<AYourActor>(FVector(i * 100, 0, 0));
-            Actors.Add(Actor);
             ASSERT_THAT(IsNotNull(Actor));
         }
 
@@ -0,0 +1,74 @@
+// 动画批量回归测试模板
+// 一次运行中以工作线程并行更新大量角色与蒙太奇组合，收集每个组合的事件记录和耗时
+
+#include "CQTest.h"
+#include "Animation/AnimInstance.h"
+#include "Animation/AnimMontage.h"
+#include "Helpers/ActorTestHelper.h"
+#include "Helpers/AnimationBatchTester.h"
+
+TEST_CLASS(AnimationBatchTestClass, "Game.Animation.Batch")
+{
+    // 数据成员
+    ActorTestSpawner Spawner;
+    TArray<USkeletalMesh*> Meshes;
+    TArray<UAnimMontage*> Montages;
+    TSubclassOf<UAnimInstance> AnimClass;
+
+    BEFORE_EACH()
+    {
+        Spawner.InitializeWorld();
+
+        // 加载测试资源（替换为实际路径）
+        Meshes.Add(LoadObject<USkeletalMesh>(nullptr, TEXT("/Game/Characters/Hero/SK_Hero")));
+        Meshes.Add(LoadObject<USkeletalMesh>(nullptr, TEXT("/Game/Characters/Enemy/SK_Enemy")));
+        Montages.Add(LoadObject<UAnimMontage>(nullptr, TEXT("/Game/Animations/AM_Attack")));
+        Montages.Add(LoadObject<UAnimMontage>(nullptr, TEXT("/Game/Animations/AM_Dodge")));
+        AnimClass = LoadClass<UAnimInstance>(nullptr, TEXT("/Game/Animations/ABP_Character.ABP_Character_C"));
+    }
+
+    AFTER_EACH()
+    {
+        Spawner.DestroyWorld();
+    }
+
+    // 所有网格 × 蒙太奇 × 播放速率的组合
+    TEST_METHOD(MontageSweep_AllCombinations_ShouldComplete)
+    {
+        const float PlayRates[] = { 0.5f, 1.0f, 1.5f };
+
+        AnimationBatchTester Tester(Spawner.GetTestWorld());
+        Tester.Reserve(Meshes.Num() * Montages.Num() * static_cast<int32>(UE_ARRAY_COUNT(PlayRates)));
+
+        for (USkeletalMesh* Mesh : Meshes)
+        {
+            for (UAnimMontage* Montage : Montages)
+            {
+                for (const float PlayRate : PlayRates)
+                {
+                    FAnimationBatchCase Case;
+                    Case.Name = FString::Printf(TEXT("%s_%s_x%.1f"), *GetNameSafe(Mesh), *GetNameSafe(Montage), PlayRate);
+                    Case.Mesh = Mesh;
+                    Case.AnimClass = AnimClass;
+                    Case.Montage = Montage;
+                    Case.PlayRate = PlayRate;
+                    ASSERT_THAT(AreNotEqual(INDEX_NONE, Tester.AddCase(Case)));
+                }
+            }
+        }
+
+        // 以60fps步长推进，直到所有蒙太奇结束
+        ASSERT_THAT(IsTrue(Tester.RunUntilMontagesComplete(1.0f / 60.0f, 20.0f)));
+        Tester.LogSummary();
+
+        for (int32 Index = 0; Index < Tester.Num(); ++Index)
+        {
+            const FAnimationEventRecorder& Recorder = Tester.GetRecorder(Index);
+            ASSERT_THAT(AreEqual(0, Recorder.GetDroppedCount()));
+            ASSERT_THAT(AreEqual(1, Recorder.CountEvents(EAnimationEventType::MontageEnded)));
+
+            // 动画蓝图应保持支持多线程更新
+            ASSERT_THAT(AreEqual(0, Tester.GetTimings(Index).GameThreadFallbackFrames));
+        }
+    }
+};
@@ -5,6 +5,7 @@
 #include "Animation/AnimMontage.h"
 #include "GameFramework/Character.h"
 #include "Helpers/AnimationTestHelper.h"
+#include "Helpers/LatentCommandHelper.h"
 
 TEST_CLASS(AnimationTestClass, "Game.Animation")
 {
@@ -86,25 +87,17 @@ TEST_CLASS(AnimationTestClass, "Game.Animation")
             return;
         }
 
-        bool MontageCompleted = false;
-
-        // 注册蒙太奇完成回调
-        AnimHelper->OnMontageEnded.AddLambda([&](UAnimMontage* EndedMontage, bool bInterrupted) {
-            if (EndedMontage == TestMontage)
-            {
-                MontageCompleted = true;
-            }
-        });
+        // 等待蒙太奇完成：委托以 TestMontage 触发即完成，不需要逐帧轮询
+        AddCommand(new TWaitForDelegate(TestRunner, AnimHelper->OnMontageEnded, [this](UAnimMontage* Montage, bool bInterrupted) {
+            return Montage == TestMontage;
+        }, 10.0f));
 
         // 播放蒙太奇
         AnimHelper->PlayMontage(TestMontage);
 
-        // 等待蒙太奇完成
-        AddCommand(new FWaitUntil([&]() {
-            return MontageCompleted;
-        }, 10.0f));
-
-        ASSERT_THAT(IsTrue(MontageCompleted));
+        AddCommand(new FExecute([&]() {
+            ASSERT_THAT(IsFalse(AnimHelper->IsMontagePlaying(TestMontage)));
+        }));
     }
 
     // 测试动画状态机
@@ -175,6 +168,144 @@ TEST_CLASS(AnimationTestClass, "Game.Animation")
         ASSERT_THAT(IsTrue(NotifyTriggered));
     }
 
+    // 离线推进蒙太奇并验证通知时序：不等待真实时间，整个测试在毫秒级完成
+    TEST_METHOD(AnimNotify_Timing_ShouldMatchMontage)
+    {
+        if (!TestMontage)
+        {
+            return;
+        }
+
+        TArray<TPair<FName, float>> NotifyTimes;
+        AnimHelper->OnNotifyBegin.AddLambda([&](FName NotifyName, const FBranchingPointNotifyPayload& Payload) {
+            NotifyTimes.Emplace(NotifyName, AnimHelper->GetCurrentMontagePosition());
+        });
+
+        const float StepDelta = 1.0f / 60.0f;
+        AnimHelper->PlayMontage(TestMontage);
+        const int32 SteppedCount = AnimHelper->StepMontage(StepDelta, FMath::CeilToInt(TestMontage->GetPlayLength() / StepDelta));
+        const float SteppedSeconds = SteppedCount * StepDelta;
+
+        // 从第一个片段沿 NextSectionName 收集实际播放的片段
+        TSet<int32> PlayedSections;
+        for (int32 SectionIndex = 0; TestMontage->IsValidSectionIndex(SectionIndex) && !PlayedSections.Contains(SectionIndex); )
+        {
+            PlayedSections.Add(SectionIndex);
+            SectionIndex = TestMontage->GetSectionIndex(TestMontage->CompositeSections[SectionIndex].NextSectionName);
+        }
+
+        // 期望的通知：只取Helper派发 OnNotifyBegin 的单次队列通知，
+        // 排除通知状态、分支点通知、未播放片段上的通知和推进范围之外的通知，再按触发时间排序
+        TArray<const FAnimNotifyEvent*> ExpectedNotifies;
+        for (const FAnimNotifyEvent& Notify : TestMontage->Notifies)
+        {
+            const float TriggerTime = Notify.GetTriggerTime();
+            if (Notify.NotifyStateClass
+                || Notify.MontageTickType == EMontageNotifyTickType::BranchingPoint
+                || !PlayedSections.Contains(TestMontage->GetSectionIndexFromPosition(TriggerTime))
+                || TriggerTime > SteppedSeconds)
+            {
+                continue;
+            }
+            ExpectedNotifies.Add(&Notify);
+        }
+        ExpectedNotifies.StableSort([](const FAnimNotifyEvent& A, const FAnimNotifyEvent& B) {
+            return A.GetTriggerTime() < B.GetTriggerTime();
+        });
+
+        // 每个期望的通知都触发一次，按时间顺序，触发时位置与对应通知的触发时间相差不超过一步
+        ASSERT_THAT(IsTrue(ExpectedNotifies.Num() > 0));
+        ASSERT_THAT(AreEqual(ExpectedNotifies.Num(), NotifyTimes.Num()));
+        for (int32 Index = 0; Index < NotifyTimes.Num(); ++Index)
+        {
+            ASSERT_THAT(IsNear(ExpectedNotifies[Index]->GetTriggerTime(), NotifyTimes[Index].Value, StepDelta));
+        }
+    }
+
+    // 离线求值指定时间的姿势
+    TEST_METHOD(EvaluateMontageAt_ShouldSeekWithoutTick)
+    {
+        if (!TestMontage)
+        {
+            return;
+        }
+
+        const float HalfTime = TestMontage->GetPlayLength() * 0.5f;
+        ASSERT_THAT(IsTrue(AnimHelper->EvaluateMontageAt(TestMontage, HalfTime)));
+        ASSERT_THAT(IsNear(HalfTime, AnimHelper->GetCurrentMontagePosition(), KINDA_SMALL_NUMBER));
+    }
+
+    // 记录一次播放的全部事件，做多项时序断言并与黄金文件比较
+    TEST_METHOD(MontageEvents_ShouldMatchGolden)
+    {
+        if (!TestMontage)
+        {
+            return;
+        }
+
+        FAnimationEventRecorder Recorder(*AnimHelper);
+
+        AnimHelper->PlayMontage(TestMontage);
+        AnimHelper->StepMontage(1.0f / 60.0f, FMath::CeilToInt(TestMontage->GetPlayLength() * 60.0f) + 1);
+
+        ASSERT_THAT(AreEqual(0, Recorder.GetDroppedCount()));
+        ASSERT_THAT(IsTrue(Recorder.NotifyFiredBetween(TEXT("TestNotify"), 0.0f, TestMontage->GetPlayLength())));
+        ASSERT_THAT(AreEqual(1, Recorder.CountEvents(EAnimationEventType::MontageEnded)));
+
+        // 带 -UpdateAnimGoldens 时写入当前记录；否则黄金文件缺失即失败
+        FString Diff;
+        const FString GoldenPath = FPaths::ProjectDir() / TEXT("Tests/AnimGoldens/TestMontage.animevents");
+        ASSERT_THAT(IsTrue(Recorder.MatchesGolden(GoldenPath, 1.0f / 60.0f, Diff), *Diff));
+    }
+
+    // 在多个时间点捕获姿势并与黄金姿势比较
+    TEST_METHOD(MontagePose_ShouldMatchGolden)
+    {
+        if (!TestMontage)
+        {
+            return;
+        }
+
+        TArray<float> Times;
+        for (float Time = 0.0f; Time <= TestMontage->GetPlayLength(); Time += 1.0f / 30.0f)
+        {
+            Times.Add(Time);
+        }
+
+        FPoseSnapshotSoA Snapshot;
+        ASSERT_THAT(IsTrue(AnimHelper->CapturePose(TestMontage, Times, Snapshot)));
+
+        // 带 -UpdateAnimGoldens 时写入当前快照；否则黄金文件缺失即失败
+        FString Diff;
+        FPoseToleranceSettings Tolerance;
+        Tolerance.RotationToleranceDegrees = 1.0f;
+        const FString GoldenPath = FPaths::ProjectDir() / TEXT("Tests/AnimGoldens/TestMontage.pose");
+        ASSERT_THAT(IsTrue(Snapshot.MatchesGolden(GoldenPath, Tolerance, Diff), *Diff));
+    }
+
+    // 动画更新开销基准：按脚本推进，分别统计更新、求值和通知派发的每帧耗时
+    TEST_METHOD(AnimationUpdateCost_ShouldNotRegress)
+    {
+        if (!TestMontage)
+        {
+            return;
+        }
+
+        FAnimationBenchmarkScript Script;
+        Script.SetState(TEXT("Idle")).Advance(30)
+            .SetState(TEXT("Run")).Advance(60)
+            .PlayMontage(TestMontage, 1.0f).Advance(60)
+            .PlayMontage(TestMontage, 1.5f).Advance(60);
+
+        const FAnimationBenchmarkResult Result = AnimHelper->RunBenchmark(Script, 1.0f / 60.0f, 5);
+        Result.Report(TestRunner);
+
+        // 动画蓝图中不支持多线程的节点会让更新回退到游戏线程
+        ASSERT_THAT(AreEqual(0, Result.GameThreadFallbackFrames.Num()));
+        ASSERT_PERF(TEXT("Animation.TestCharacter.Update"), Result.Update);
+        ASSERT_PERF(TEXT("Animation.TestCharacter.Evaluate"), Result.Evaluate);
+    }
+
     // 使用Command Builder测试复杂动画流程
     TEST_METHOD(AnimationWorkflow_UsingCommandBuilder)
     {
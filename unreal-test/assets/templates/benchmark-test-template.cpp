@@ -0,0 +1,141 @@
+// 微基准测试模板 - 使用BENCHMARK_METHOD宏
+// 与TEST_METHOD共用BEFORE_EACH/AFTER_EACH，结果写入测试日志并可导出为JSON/CSV
+
+#include "CQTest.h"
+#include "Async/ParallelFor.h"
+#include "Helpers/BenchmarkTestHelper.h"
+#include "Helpers/LatentCommandArena.h"
+
+TEST_CLASS(YourBenchmarkClass, "Game.Benchmark.YourModule")
+{
+    // 数据成员
+    TArray<FVector> AllLocations;
+    TArray<FVector> ProcessedLocations;
+
+    // 在每个基准测试之前准备数据，不计入耗时
+    BEFORE_EACH()
+    {
+        const int32 NumLocations = 100000;
+        AllLocations.SetNumUninitialized(NumLocations);
+        ProcessedLocations.SetNumUninitialized(NumLocations);
+
+        FRandomStream Random(42);
+        for (FVector& Location : AllLocations)
+        {
+            Location = Random.VRand() * 10000.0f;
+        }
+    }
+
+    // 可选：所有基准测试结束后导出结果
+    AFTER_ALL()
+    {
+        FTestBenchmarkReporter::WriteJson(FTestBenchmarkReporter::GetOutputDirectory() / TEXT("YourModule.json"));
+        FTestBenchmarkReporter::WriteCsv(FTestBenchmarkReporter::GetOutputDirectory() / TEXT("YourModule.csv"));
+    }
+
+protected:
+    static FVector ProcessLocation(const FVector& Location)
+    {
+        return Location.GetSafeNormal() * FMath::Sqrt(Location.Size());
+    }
+
+public:
+    // 普通循环
+    BENCHMARK_METHOD(ProcessLocations_Sequential)
+    {
+        while (State.KeepRunning())
+        {
+            for (int32 Index = 0; Index < AllLocations.Num(); ++Index)
+            {
+                ProcessedLocations[Index] = ProcessLocation(AllLocations[Index]);
+            }
+            DoNotOptimize(ProcessedLocations);
+        }
+    }
+
+    // ParallelFor
+    BENCHMARK_METHOD(ProcessLocations_ParallelFor)
+    {
+        while (State.KeepRunning())
+        {
+            ParallelFor(AllLocations.Num(), [this](int32 Index)
+            {
+                ProcessedLocations[Index] = ProcessLocation(AllLocations[Index]);
+            });
+            DoNotOptimize(ProcessedLocations);
+        }
+    }
+
+    // 自定义参数，并排除每次迭代中的准备代码
+    BENCHMARK_METHOD(SortLocations_ExcludingCopy)
+    {
+        FTestBenchmarkSettings Settings;
+        Settings.NumSamples = 10;
+        Settings.MinSampleSeconds = 0.05;
+        State.Configure(Settings);
+
+        TArray<FVector> Working;
+        while (State.KeepRunning())
+        {
+            State.PauseTiming();
+            Working = AllLocations;
+            State.ResumeTiming();
+
+            Working.Sort([](const FVector& A, const FVector& B) { return A.X < B.X; });
+            DoNotOptimize(Working);
+        }
+    }
+
+    // 10000步命令序列：每步单独堆分配（FExecute + TFunction捕获）
+    BENCHMARK_METHOD(CommandSequence10k_Heap)
+    {
+        const int32 NumSteps = 10000;
+        int64 Sum = 0;
+
+        TArray<TUniquePtr<IAutomationLatentCommand>> Commands;
+        Commands.Reserve(NumSteps);
+        while (State.KeepRunning())
+        {
+            for (int32 Index = 0; Index < NumSteps; ++Index)
+            {
+                const FVector Location = AllLocations[Index];
+                Commands.Emplace(new FExecute([&Sum, Location, Index]() {
+                    Sum += Index + static_cast<int64>(Location.X);
+                }));
+            }
+
+            for (TUniquePtr<IAutomationLatentCommand>& Command : Commands)
+            {
+                Command->Update();
+            }
+
+            Commands.Reset();
+            DoNotOptimize(Sum);
+        }
+    }
+
+    // 10000步命令序列：竞技场分配，Lambda捕获就地存放，测试结束时一次性释放
+    BENCHMARK_METHOD(CommandSequence10k_Arena)
+    {
+        const int32 NumSteps = 10000;
+        int64 Sum = 0;
+
+        while (State.KeepRunning())
+        {
+            FLatentCommandArena Arena(TestRunner, 1024 * 1024);
+            FArenaSequenceCommand* Sequence = Arena.Sequence();
+            for (int32 Index = 0; Index < NumSteps; ++Index)
+            {
+                const FVector Location = AllLocations[Index];
+                Sequence->Do([&Sum, Location, Index]() {
+                    Sum += Index + static_cast<int64>(Location.X);
+                });
+            }
+
+            // 序列只有Do步骤，一次Update执行完全部步骤
+            Sequence->Update();
+            delete Sequence;
+            DoNotOptimize(Sum);
+        }
+    }
+};
@@ -0,0 +1,169 @@
+// Input录制回放与批量输入测试模板
+// 回放录制的游玩过程作为回归测试：固定步长推进世界，速度远快于真实时间
+// 批量注入与多世界随机输入用于在一次运行中覆盖大量输入组合
+
+#include "CQTest.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "Helpers/ActorTestHelper.h"
+#include "Helpers/InputTestHelper.h"
+#include "Helpers/MultiWorldTestRunner.h"
+
+TEST_CLASS(InputReplayTestClass, "Game.Input.Replay")
+{
+    // 数据成员
+    ActorTestSpawner Spawner;
+    AMyCharacter* TestCharacter = nullptr;
+    TUniquePtr<InputTestHelper> InputHelper;
+
+    BEFORE_EACH()
+    {
+        Spawner.InitializeWorld();
+        TestCharacter = Spawner.SpawnActor<AMyCharacter>(FVector::ZeroVector);
+        TestCharacter->AutoPossessPlayer = EAutoReceiveInput::Player0;
+
+        InputHelper = MakeUnique<InputTestHelper>(TestCharacter);
+        InputHelper->Initialize();
+    }
+
+    AFTER_EACH()
+    {
+        InputHelper->Cleanup();
+        InputHelper.Reset();
+        Spawner.DestroyWorld();
+    }
+
+    // 回放录制文件（在PIE中通过 Input.StartRecording / Input.StopRecording <FilePath> 录制）
+    TEST_METHOD(RecordedSession_ShouldReplayWithoutErrors)
+    {
+        FInputRecording Recording;
+        const FString RecordingPath = FPaths::ProjectDir() / TEXT("Tests/InputRecordings/Level1_Session.irec");
+        ASSERT_THAT(IsTrue(Recording.LoadFromFile(RecordingPath)));
+
+        FInputReplayer Replayer(*InputHelper, Recording);
+        ASSERT_THAT(AreEqual(0, Replayer.GetUnboundActions().Num()));
+
+        // 逐帧检查不变量，失败时停止回放并报告帧序号
+        uint32 FailedFrame = 0;
+        const bool bCompleted = Replayer.ReplayAll(Spawner, [&](uint32 Frame) {
+            if (TestCharacter->GetHealth() < 0.0f || TestCharacter->GetActorLocation().Z < -10000.0f)
+            {
+                FailedFrame = Frame;
+                return false;
+            }
+            return true;
+        });
+
+        ASSERT_THAT(IsTrue(bCompleted, *FString::Printf(TEXT("Invariant failed at frame %u"), FailedFrame)));
+    }
+
+    // 在测试中录制再回放，验证同一输入序列的结果可复现
+    TEST_METHOD(RecordAndReplay_ShouldBeDeterministic)
+    {
+        // 录制器按自身步数记录帧序号，每推进世界一帧调用一次 AdvanceFrame
+        FInputRecorder Recorder(*InputHelper);
+        Recorder.Start();
+        for (int32 Frame = 0; Frame < 120; ++Frame)
+        {
+            InputHelper->TriggerAction(TEXT("Move"), FInputActionValue(FVector2D(1.0f, 0.0f)));
+            if (Frame == 30)
+            {
+                InputHelper->TriggerAction(TEXT("Jump"));
+            }
+            Spawner.AdvanceWorld(1);
+            Recorder.AdvanceFrame();
+        }
+        Recorder.Stop();
+        const FVector RecordedLocation = TestCharacter->GetActorLocation();
+
+        // 重置角色后回放
+        TestCharacter->SetActorLocation(FVector::ZeroVector);
+        TestCharacter->GetCharacterMovement()->StopMovementImmediately();
+        FInputReplayer Replayer(*InputHelper, Recorder.GetRecording());
+        ASSERT_THAT(IsTrue(Replayer.ReplayAll(Spawner)));
+        ASSERT_THAT(IsTrue(TestCharacter->GetActorLocation().Equals(RecordedLocation, 1.0f)));
+    }
+
+    // 一帧内注入多个带时间戳的事件：先移动后跳跃再开火
+    TEST_METHOD(InputBatch_ShouldInjectInTimestampOrder)
+    {
+        FInputEventBatch Batch;
+        const int32 Fire = Batch.FindOrAddAction(TEXT("Fire"));
+        const int32 Move = Batch.FindOrAddAction(TEXT("Move"));
+        const int32 Jump = Batch.FindOrAddAction(TEXT("Jump"));
+
+        Batch.Add(Fire, FInputActionValue(true), 0.9f);
+        Batch.Add(Move, FInputActionValue(FVector2D(0.0f, 1.0f)), 0.1f);
+        Batch.Add(Jump, FInputActionValue(true), 0.5f);
+
+        // 为三个动作额外绑定记录回调，按回调触发顺序记录动作名
+        UEnhancedInputComponent* InputComponent = InputHelper->GetInputComponent();
+        TArray<const UInputAction*> RecordedActions;
+        for (const TUniquePtr<FEnhancedInputActionEventBinding>& Binding : InputComponent->GetActionEventBindings())
+        {
+            const UInputAction* Action = Binding->GetAction();
+            if (Action && Batch.GetActionNames().Contains(Action->GetFName()))
+            {
+                RecordedActions.AddUnique(Action);
+            }
+        }
+        ASSERT_THAT(AreEqual(3, RecordedActions.Num()));
+
+        TArray<FName> InjectedOrder;
+        TArray<uint32> RecordHandles;
+        for (const UInputAction* Action : RecordedActions)
+        {
+            const FName ActionName = Action->GetFName();
+            RecordHandles.Add(InputComponent->BindActionValueLambda(Action, ETriggerEvent::Triggered, [&InjectedOrder, ActionName](const FInputActionValue&) {
+                InjectedOrder.Add(ActionName);
+            }).GetHandle());
+        }
+
+        const int32 NumInjected = InputHelper->InjectBatch(Batch);
+        for (const uint32 Handle : RecordHandles)
+        {
+            InputComponent->RemoveBindingByHandle(Handle);
+        }
+
+        // 添加顺序为 Fire、Move、Jump，注入顺序应按时间戳为 Move、Jump、Fire
+        ASSERT_THAT(AreEqual(3, NumInjected));
+        const TArray<FName> ExpectedOrder = { TEXT("Move"), TEXT("Jump"), TEXT("Fire") };
+        ASSERT_THAT(IsTrue(InjectedOrder == ExpectedOrder));
+
+        Spawner.AdvanceWorld(1);
+        ASSERT_THAT(IsTrue(TestCharacter->IsJumping()));
+    }
+
+    // 多个世界交错运行种子确定的随机输入，检查角色状态机不变量
+    TEST_METHOD(InputFuzz_MultiWorld_ShouldHoldInvariants)
+    {
+        FInputFuzzerSettings Settings;
+        Settings.Seed = 20240601;
+        Settings.NumFrames = 1800;
+        Settings.MaxEventsPerFrame = 64;
+
+        FInputFuzzer Fuzzer(Settings);
+        FMultiWorldTestRunner Runner;
+        Fuzzer.AddWorlds(Runner, 16,
+            [](ActorTestSpawner& WorldSpawner) -> APawn* {
+                AMyCharacter* Character = WorldSpawner.SpawnActor<AMyCharacter>(FVector::ZeroVector);
+                Character->AutoPossessPlayer = EAutoReceiveInput::Player0;
+                return Character;
+            },
+            [](APawn* Pawn, FString& OutDescription) {
+                const AMyCharacter* Character = CastChecked<AMyCharacter>(Pawn);
+                if (Character->IsDead() && Character->IsAttacking())
+                {
+                    OutDescription = TEXT("Dead character is still attacking");
+                    return false;
+                }
+                return true;
+            });
+
+        const FMultiWorldRunReport RunReport = Runner.Run();
+        Fuzzer.Report(TestRunner, RunReport.WallSeconds);
+
+        // 失败记录中的种子和帧序号可以直接用于复现
+        ASSERT_THAT(AreEqual(0, Fuzzer.GetFailures().Num()));
+    }
+};
@@ -7,6 +7,7 @@
 #include "GameFramework/GameStateBase.h"
 #include "GameFramework/GameModeBase.h"
 #include "Kismet/GameplayStatics.h"
+#include "Helpers/ActorTestHelper.h"
 
 TEST_CLASS(MapLoadingTest, "Game.Map")
     , public EAutomationTestFlags::EditorContext
@@ -86,17 +87,16 @@ TEST_CLASS(MapLoadingTest, "Game.Map")
     // 测试生成多个Actor
     TEST_METHOD(SpawnMultipleActors_ShouldAllSucceed)
     {
-        TArray<AActor*> SpawnedActors;
+        // 批量生成：整批延迟构造后集中完成生成，比逐个SpawnActor开销更小
+        TArray<AActor*> SpawnedActors = ActorTestHelper::SpawnActorsBatch<AActor>(CurrentWorld, 10, [](int32 Index) {
+            return FTransform(FVector(Index * 100, 0, 0));
+        });
 
-        for (int32 i = 0; i < 10; i++)
+        ASSERT_THAT(AreEqual(10, SpawnedActors.Num()));
+        for (AActor* Actor : SpawnedActors)
         {
-            FVector SpawnLocation = FVector(i * 100, 0, 0);
-            AActor* Actor = CurrentWorld->SpawnActor<AActor>(SpawnLocation);
-            SpawnedActors.Add(Actor);
             ASSERT_THAT(IsNotNull(Actor));
         }
-
-        ASSERT_THAT(AreEqual(10, SpawnedActors.Num()));
     }
 
     // 测试Actor销毁
@@ -0,0 +1,65 @@
+// Network协程测试实现文件模板
+// 注意：必须指定 EAutomationTestFlags::EditorContext 标志
+// 注意：TEST_COROUTINE 需要C++20，在测试模块的Build.cs中设置 CppStandard = CppStandardVersion.Cpp20（UE5.3起为默认值）
+
+#include "CQTest.h"
+#include "GameFramework/Actor.h"
+#include "NetworkTestHelper.h"
+#include "Helpers/CoroutineTestHelper.h"
+
+TEST_CLASS(NetworkCoroutineTest, "Game.Network.Coroutine")
+    , public EAutomationTestFlags::EditorContext
+{
+    // 数据成员
+    NetworkTestHelper* NetworkHelper = nullptr;
+    AMyNetworkActor* ServerActor = nullptr;
+
+    // 在每个测试之前执行
+    BEFORE_EACH()
+    {
+        // 初始化网络：1服务器，1客户端
+        NetworkHelper = new NetworkTestHelper();
+        ASSERT_THAT(IsTrue(NetworkHelper->Initialize(1)));
+
+        ServerActor = NetworkHelper->GetServerWorld()->SpawnActor<AMyNetworkActor>(FVector::ZeroVector);
+        ASSERT_THAT(IsNotNull(ServerActor));
+    }
+
+    // 在每个测试之后执行
+    AFTER_EACH()
+    {
+        if (NetworkHelper)
+        {
+            NetworkHelper->Shutdown();
+            delete NetworkHelper;
+            NetworkHelper = nullptr;
+        }
+    }
+
+    // 使用协程测试网络流程：等待按顺序书写，协程在服务器世界的Tick中恢复
+    TEST_COROUTINE(NetworkWorkflow_UsingCoroutine, NetworkHelper->GetServerWorld())
+    {
+        const int32 TestValue = 100;
+
+        // 设置复制变量，等待复制到客户端
+        ServerActor->SetReplicatedValue(TestValue);
+        AMyNetworkActor* ClientActor = nullptr;
+        co_await WaitUntil([&]() {
+            ClientActor = NetworkHelper->GetClientActor<AMyNetworkActor>(0);
+            return ClientActor && ClientActor->GetReplicatedValue() == TestValue;
+        }, 5.0f);
+
+        // 调用服务器RPC，等待服务器收到（先订阅再调用，不会错过同步触发的事件）
+        auto ServerRPCCalled = WaitForDelegate(ServerActor->OnServerRPCCalled, 3.0f);
+        ClientActor->Server_ExecuteRPC();
+        co_await ServerRPCCalled;
+
+        // 调用客户端RPC，等待客户端收到
+        auto ClientRPCCalled = WaitForDelegate(ClientActor->OnClientRPCCalled, 3.0f);
+        ServerActor->Client_ExecuteRPC(ClientActor);
+        co_await ClientRPCCalled;
+
+        // 验证复制值在RPC往返后保持不变
+        CO_ASSERT_THAT(AreEqual(TestValue, ClientActor->GetReplicatedValue()));
+    }
+};
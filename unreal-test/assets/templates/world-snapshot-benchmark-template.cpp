@@ -0,0 +1,78 @@
+// 世界快照基准测试模板
+// 对比每个测试冷启动世界（InitializeWorld/DestroyWorld）与快照恢复（RestoreWorldSnapshot）的耗时
+
+#include "CQTest.h"
+#include "HAL/PlatformTime.h"
+#include "Helpers/ActorTestHelper.h"
+
+TEST_CLASS(WorldSnapshotBenchmark, "Game.Benchmark.WorldSnapshot")
+{
+    // 数据成员
+    ActorTestSpawner Spawner;
+
+    // 每轮模拟的测试次数
+    static constexpr int32 NumIterations = 50;
+
+    // 每轮准备的公共Actor数量
+    static constexpr int32 NumFixtureActors = 100;
+
+protected:
+    // 准备公共Actor（替换为实际的测试场景）
+    void SpawnFixtureActors()
+    {
+        Spawner.SpawnActorsBatch<AYourActor>(NumFixtureActors, [](int32 Index) {
+            return FTransform(FVector(Index * 100, 0, 0));
+        });
+    }
+
+    // 模拟一个测试对世界的修改
+    void MutateWorld()
+    {
+        Spawner.SpawnActor<AOtherActor>(FVector(0, 100, 0));
+    }
+
+    void ReportResult(const TCHAR* Label, double TotalSeconds)
+    {
+        TestRunner.AddInfo(FString::Printf(TEXT("%s: %.3f ms/iteration (%d iterations)"),
+            Label, TotalSeconds * 1000.0 / NumIterations, NumIterations));
+    }
+
+public:
+    // 冷启动：每次都重建世界
+    TEST_METHOD(ColdInitialize_PerIteration)
+    {
+        const double StartTime = FPlatformTime::Seconds();
+
+        for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+        {
+            ASSERT_THAT(IsTrue(Spawner.InitializeWorld()));
+            SpawnFixtureActors();
+            MutateWorld();
+            Spawner.DestroyWorld();
+        }
+
+        ReportResult(TEXT("Cold initialize"), FPlatformTime::Seconds() - StartTime);
+    }
+
+    // 快照恢复：世界只创建一次
+    TEST_METHOD(SnapshotRestore_PerIteration)
+    {
+        ASSERT_THAT(IsTrue(Spawner.InitializeWorld()));
+        SpawnFixtureActors();
+        ASSERT_THAT(IsTrue(Spawner.CaptureWorldSnapshot()));
+
+        const double StartTime = FPlatformTime::Seconds();
+
+        for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+        {
+            MutateWorld();
+            ASSERT_THAT(IsTrue(Spawner.RestoreWorldSnapshot() >= 0));
+        }
+
+        ReportResult(TEXT("Snapshot restore"), FPlatformTime::Seconds() - StartTime);
+
+        // 恢复时回收了每轮新增Actor的槽位，数量回到快照时的公共Actor数
+        ASSERT_THAT(AreEqual(NumFixtureActors, Spawner.GetSpawnedActorCount()));
+        Spawner.DestroyWorld();
+    }
+};